@@ -0,0 +1,393 @@
+﻿
+#include "arinc429/arinc429.h"
+#include "arinc429/batch.h"
+#include "arinc429/compressed_capture.h"
+#include "arinc429/dispatch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace
+{
+    constexpr size_t words_count = 4096;
+
+    struct uint_head : eld::arinc429::data_descriptor<uint_head, 1, 10, uint32_t>
+    {
+    };
+    struct uint_center : eld::arinc429::data_descriptor<uint_center, 11, 20, uint32_t>
+    {
+    };
+    struct uint_tail : eld::arinc429::data_descriptor<uint_tail, 21, 32, uint32_t>
+    {
+    };
+    struct int_head : eld::arinc429::data_descriptor<int_head, 1, 10, int32_t>
+    {
+    };
+    struct int_center : eld::arinc429::data_descriptor<int_center, 11, 20, int32_t>
+    {
+    };
+    struct int_tail : eld::arinc429::data_descriptor<int_tail, 21, 32, int32_t>
+    {
+    };
+    struct double_head
+      : eld::arinc429::data_descriptor<double_head, 1, 10, double, std::ratio<1, 100>>
+    {
+    };
+    struct double_center
+      : eld::arinc429::data_descriptor<double_center, 11, 20, double, std::ratio<1, 100>>
+    {
+    };
+    struct double_tail
+      : eld::arinc429::data_descriptor<double_tail, 21, 32, double, std::ratio<1, 100>>
+    {
+    };
+
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data_0 : eld::arinc429::data_descriptor<data_0, 11, 13, uint8_t>
+    {
+    };
+    struct data_1 : eld::arinc429::data_descriptor<data_1, 14, 15, uint8_t>
+    {
+    };
+    struct data_2 : eld::arinc429::data_descriptor<data_2, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    struct state_matrix : eld::arinc429::data_descriptor<state_matrix, 30, 31, uint8_t>
+    {
+    };
+
+    using complex_word_t = eld::arinc429::word_generic<label, data_0, data_1, data_2, state_matrix>;
+
+    const std::vector<eld::arinc429::traits::word_raw_type> &raw_words()
+    {
+        static const std::vector<eld::arinc429::traits::word_raw_type> rawWords = [] {
+            std::vector<eld::arinc429::traits::word_raw_type> words(words_count);
+            uint32_t state = 0xf3f21872;
+            for (auto &word : words)
+            {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                word = state;
+            }
+            return words;
+        }();
+        return rawWords;
+    }
+
+    void set_words_processed(benchmark::State &state, size_t wordsPerIteration)
+    {
+        const double processed = double(state.iterations()) * double(wordsPerIteration);
+        state.counters["words"] = benchmark::Counter(processed, benchmark::Counter::kIsRate);
+    }
+
+    template<typename DataDescriptor>
+    void bm_get(benchmark::State &state)
+    {
+        using word_t = eld::arinc429::word_generic<DataDescriptor>;
+        const auto &rawWords = raw_words();
+
+        for (auto _ : state)
+        {
+            for (const auto rawWord : rawWords)
+            {
+                word_t word{ rawWord };
+                benchmark::DoNotOptimize(word.template get<DataDescriptor>());
+            }
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    template<typename DataDescriptor>
+    void bm_set(benchmark::State &state)
+    {
+        using word_t = eld::arinc429::word_generic<DataDescriptor>;
+        using value_type = eld::arinc429::traits::value_type_t<DataDescriptor>;
+        const auto &rawWords = raw_words();
+
+        for (auto _ : state)
+        {
+            for (const auto rawWord : rawWords)
+            {
+                word_t word{ 0 };
+                word.template set<DataDescriptor>(value_type(rawWord % 512));
+                benchmark::DoNotOptimize(word);
+            }
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_modify(benchmark::State &state)
+    {
+        using word_t = eld::arinc429::word_generic<uint_center>;
+        const auto &rawWords = raw_words();
+
+        for (auto _ : state)
+        {
+            for (const auto rawWord : rawWords)
+            {
+                word_t word{ rawWord };
+                eld::arinc429::modify<uint_center>(word) += 3u;
+                eld::arinc429::modify<uint_center>(word) &= 0x1f0u;
+                benchmark::DoNotOptimize(word);
+            }
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_modify_batch(benchmark::State &state)
+    {
+        using word_t = eld::arinc429::word_generic<uint_center>;
+        const auto &rawWords = raw_words();
+        std::vector<word_t> words(rawWords.begin(), rawWords.end());
+
+        for (auto _ : state)
+        {
+            eld::arinc429::modify<uint_center>(words.data(), words.size()) += 3u;
+            eld::arinc429::modify<uint_center>(words.data(), words.size()) &= 0x1f0u;
+            benchmark::DoNotOptimize(words.data());
+            benchmark::ClobberMemory();
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_get_all(benchmark::State &state)
+    {
+        const auto &rawWords = raw_words();
+
+        for (auto _ : state)
+        {
+            for (const auto rawWord : rawWords)
+            {
+                const complex_word_t word{ rawWord };
+                benchmark::DoNotOptimize(word.get_all());
+            }
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    template<typename DataDescriptor>
+    void bm_decode_batch(benchmark::State &state)
+    {
+        const auto &rawWords = raw_words();
+        std::vector<eld::arinc429::traits::value_type_t<DataDescriptor>> values(rawWords.size());
+
+        for (auto _ : state)
+        {
+            eld::arinc429::decode_batch<DataDescriptor>(rawWords.data(),
+                                                        rawWords.size(),
+                                                        values.data());
+            benchmark::DoNotOptimize(values.data());
+            benchmark::ClobberMemory();
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_decode_soa(benchmark::State &state)
+    {
+        const auto &rawWords = raw_words();
+        std::vector<uint8_t> labels(rawWords.size());
+        std::vector<uint8_t> data0(rawWords.size());
+        std::vector<uint8_t> data1(rawWords.size());
+        std::vector<double> data2(rawWords.size());
+        std::vector<uint8_t> states(rawWords.size());
+
+        for (auto _ : state)
+        {
+            eld::arinc429::decode_soa<complex_word_t>(rawWords.data(),
+                                                      rawWords.size(),
+                                                      labels.data(),
+                                                      data0.data(),
+                                                      data1.data(),
+                                                      data2.data(),
+                                                      states.data());
+            benchmark::ClobberMemory();
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_parity(benchmark::State &state)
+    {
+        const auto &rawWords = raw_words();
+
+        for (auto _ : state)
+        {
+            uint32_t valid = 0;
+            for (const auto rawWord : rawWords)
+            {
+                valid += eld::arinc429::validate_parity(rawWord);
+            }
+            benchmark::DoNotOptimize(valid);
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_validate_parity_batch(benchmark::State &state)
+    {
+        const auto &rawWords = raw_words();
+        std::vector<uint64_t> badWords((rawWords.size() + 63) / 64);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(eld::arinc429::validate_parity_batch(rawWords.data(),
+                                                                          rawWords.size(),
+                                                                          badWords.data()));
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_filter_ssm(benchmark::State &state)
+    {
+        const auto &rawWords = raw_words();
+        std::vector<uint32_t> indices(rawWords.size());
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(eld::arinc429::filter_ssm_batch(rawWords.data(),
+                                                                     rawWords.size(),
+                                                                     eld::arinc429::bnr_valid_ssm,
+                                                                     indices.data()));
+            benchmark::ClobberMemory();
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_partition_sdi(benchmark::State &state)
+    {
+        const auto &rawWords = raw_words();
+        std::vector<eld::arinc429::traits::word_raw_type> buffers[4];
+        for (auto &buffer : buffers)
+        {
+            buffer.resize(rawWords.size());
+        }
+        eld::arinc429::traits::word_raw_type *const out[]{ buffers[0].data(),
+                                                           buffers[1].data(),
+                                                           buffers[2].data(),
+                                                           buffers[3].data() };
+        size_t counts[4]{};
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                eld::arinc429::partition_sdi_batch(rawWords.data(),
+                                                   rawWords.size(),
+                                                   out,
+                                                   counts,
+                                                   eld::arinc429::bnr_valid_ssm));
+            benchmark::ClobberMemory();
+        }
+        set_words_processed(state, rawWords.size());
+    }
+
+    void bm_decode_capture_block(benchmark::State &state)
+    {
+        // slowly changing data of a few labels, as in a bus recording
+        const uint8_t labels[]{ 0203, 0204, 0205, 0206, 0312 };
+        eld::arinc429::detail::capture_block_encoder encoder;
+        encoder.reset();
+        for (size_t i = 0; i < words_count; ++i)
+        {
+            const uint32_t data = uint32_t(i / 50 + labels[i % 5] * 1000) & 0x7ffff;
+            encoder.encode(eld::arinc429::capture_record{ 100 * i,
+                                                          0x60000000u | data << 10 | labels[i % 5],
+                                                          uint16_t(i % 2),
+                                                          0 });
+        }
+
+        std::vector<eld::arinc429::capture_record> records(words_count);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                eld::arinc429::detail::decode_capture_block(encoder.bytes().data(),
+                                                            encoder.bytes().size(),
+                                                            words_count,
+                                                            records.data()));
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(int64_t(state.iterations()) *
+                                int64_t(words_count * sizeof(eld::arinc429::capture_record)));
+        set_words_processed(state, words_count);
+    }
+
+    void bm_dispatch(benchmark::State &state)
+    {
+        using data_word_t = eld::arinc429::word_generic<label, int_center>;
+        using angle_word_t = eld::arinc429::word_generic<label, data_2>;
+        using dispatcher_t =
+            eld::arinc429::label_dispatcher<eld::arinc429::label_word<0312, data_word_t>,
+                                            eld::arinc429::label_word<0162, angle_word_t>,
+                                            eld::arinc429::label_word<0100, complex_word_t>>;
+
+        struct handler
+        {
+            void operator()(data_word_t word) { sum += word.get<int_center>(); }
+
+            void operator()(angle_word_t word) { sum += word.get<data_2>(); }
+
+            void operator()(complex_word_t word) { sum += word.get<data_0>(); }
+
+            double sum = 0;
+        };
+
+        // a third of the words have each of the labels
+        std::vector<eld::arinc429::traits::word_raw_type> rawWords = raw_words();
+        const uint8_t labels[]{ 0312, 0162, 0100 };
+        for (size_t i = 0; i < rawWords.size(); ++i)
+        {
+            rawWords[i] = (rawWords[i] & ~0xffu) | labels[i % 3];
+        }
+
+        const dispatcher_t dispatcher;
+        handler wordHandler;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                dispatcher.dispatch(rawWords.data(), rawWords.size(), wordHandler));
+        }
+        benchmark::DoNotOptimize(wordHandler.sum);
+        set_words_processed(state, rawWords.size());
+    }
+}
+
+BENCHMARK_TEMPLATE(bm_get, uint_head);
+BENCHMARK_TEMPLATE(bm_get, uint_center);
+BENCHMARK_TEMPLATE(bm_get, uint_tail);
+BENCHMARK_TEMPLATE(bm_get, int_head);
+BENCHMARK_TEMPLATE(bm_get, int_center);
+BENCHMARK_TEMPLATE(bm_get, int_tail);
+BENCHMARK_TEMPLATE(bm_get, double_head);
+BENCHMARK_TEMPLATE(bm_get, double_center);
+BENCHMARK_TEMPLATE(bm_get, double_tail);
+
+BENCHMARK_TEMPLATE(bm_set, uint_head);
+BENCHMARK_TEMPLATE(bm_set, uint_center);
+BENCHMARK_TEMPLATE(bm_set, uint_tail);
+BENCHMARK_TEMPLATE(bm_set, int_head);
+BENCHMARK_TEMPLATE(bm_set, int_center);
+BENCHMARK_TEMPLATE(bm_set, int_tail);
+BENCHMARK_TEMPLATE(bm_set, double_head);
+BENCHMARK_TEMPLATE(bm_set, double_center);
+BENCHMARK_TEMPLATE(bm_set, double_tail);
+
+BENCHMARK(bm_modify);
+BENCHMARK(bm_modify_batch);
+BENCHMARK(bm_get_all);
+
+BENCHMARK_TEMPLATE(bm_decode_batch, uint_center);
+BENCHMARK_TEMPLATE(bm_decode_batch, int_center);
+BENCHMARK_TEMPLATE(bm_decode_batch, double_center);
+BENCHMARK(bm_decode_soa);
+
+BENCHMARK(bm_parity);
+BENCHMARK(bm_validate_parity_batch);
+BENCHMARK(bm_filter_ssm);
+BENCHMARK(bm_partition_sdi);
+
+BENCHMARK(bm_dispatch);
+
+BENCHMARK(bm_decode_capture_block);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+﻿/**
+ * Compile-time benchmark: instantiates many wide word types and accesses each of their data
+ * by name, like generated ICD headers do. Build target arinc429_compile_bench to measure.
+ */
+
+#include "arinc429/arinc429.h"
+
+#include <utility>
+
+#ifndef ELD_ARINC429_BENCH_WORDS
+#    define ELD_ARINC429_BENCH_WORDS 256
+#endif
+
+namespace
+{
+    template<size_t Word, size_t Field>
+    struct field : eld::arinc429::data_descriptor<field<Word, Field>,
+                                                  2 * Field + 1,
+                                                  2 * Field + 2,
+                                                  uint8_t>
+    {
+    };
+
+    template<size_t Word, typename FieldIndexes>
+    struct make_word;
+
+    template<size_t Word, size_t... Fields>
+    struct make_word<Word, std::index_sequence<Fields...>>
+    {
+        using type = eld::arinc429::word_generic<field<Word, Fields>...>;
+
+        static uint32_t access(uint32_t rawWord)
+        {
+            type word{ rawWord };
+            uint32_t sum = 0;
+            const int expand[]{ 0,
+                                (word.template set<field<Word, Fields>>(uint8_t(Fields)),
+                                 sum += word.template get<field<Word, Fields>>(),
+                                 0)... };
+            (void)expand;
+            return sum;
+        }
+    };
+
+    template<size_t... Words>
+    uint32_t access_all(uint32_t rawWord, std::index_sequence<Words...>)
+    {
+        uint32_t sum = 0;
+        const int expand[]{
+            0,
+            (sum += make_word<Words, std::make_index_sequence<16>>::access(rawWord + Words), 0)...
+        };
+        (void)expand;
+        return sum;
+    }
+}
+
+int main(int argc, char **)
+{
+    return int(access_all(uint32_t(argc),
+                          std::make_index_sequence<ELD_ARINC429_BENCH_WORDS>()) &
+               1u);
+}
@@ -0,0 +1,342 @@
+﻿#pragma once
+
+#include "arinc429/dispatch.h"
+#include "arinc429/label_cache.h"
+#include "arinc429/ring_buffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#    define ELD_ARINC429_HAS_AFFINITY
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+#if defined(_WIN32)
+#    include <malloc.h>
+#endif
+
+/**
+ * Reception of many channels by a pool of workers.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Assign channels to workers in turn.
+         * @return worker of each channel.
+         */
+        inline std::vector<size_t> round_robin_workers(size_t channelsCount, size_t workersCount)
+        {
+            std::vector<size_t> workers(channelsCount);
+            for (size_t channel = 0; channel < channelsCount; ++channel)
+            {
+                workers[channel] = workersCount ? channel % workersCount : 0;
+            }
+            return workers;
+        }
+
+        /**
+         * Pin the calling thread to a core.
+         * @return false if affinity is not supported or the core is not available.
+         */
+        inline bool pin_current_thread(size_t core)
+        {
+#if defined(ELD_ARINC429_HAS_AFFINITY)
+            if (core >= CPU_SETSIZE)
+            {
+                return false;
+            }
+            cpu_set_t cores;
+            CPU_ZERO(&cores);
+            CPU_SET(core, &cores);
+            return pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores) == 0;
+#else
+            (void)core;
+            return false;
+#endif
+        }
+
+        namespace detail
+        {
+            /**
+             * Handler that ignores words.
+             */
+            struct ignore_words
+            {
+            };
+
+            /**
+             * Passes the channel to a handler of an aggregator along with each word.
+             */
+            template<typename Handler>
+            struct channel_handler
+            {
+                template<typename WordT>
+                void operator()(const WordT &word)
+                {
+                    handler(channel, word);
+                }
+
+                Handler &handler;
+                uint16_t channel;
+            };
+        }
+
+        /**
+         * Receives words of many channels, each through its own spsc_ring, on a pool of workers.
+         * Each channel is owned by a worker given by a static channel-to-worker map, the worker
+         * stores its words in the label cache of the channel and dispatches them to a handler.
+         * An idle worker steals from other channels only when their rings are filled to the
+         * steal threshold, so in steady state every ring is consumed by a single core.
+         * A channel is consumed by one worker at a time, so the order of its words is kept.
+         * Workers are not started by the aggregator: each worker thread calls poll or run with
+         * its index and may pin itself with pin_current_thread.
+         * @tparam RingCapacity capacity of the ring of each channel, power of two.
+         * @tparam SdiSlots slots of the label caches, see basic_label_cache.
+         * @tparam InstrumentationT instrumentation policy of the dispatchers.
+         * @tparam LabelWords label_word bindings.
+         */
+        template<size_t RingCapacity,
+                 size_t SdiSlots,
+                 typename InstrumentationT,
+                 typename... LabelWords>
+        class basic_channel_aggregator
+        {
+        public:
+            using ring_type = spsc_ring<RingCapacity>;
+            using cache_type = basic_label_cache<SdiSlots, null_instrumentation, LabelWords...>;
+            using dispatcher_type = basic_label_dispatcher<InstrumentationT, LabelWords...>;
+            using cache_snapshot_type = typename cache_type::snapshot_type;
+
+            /**
+             * @param channelWorkers worker of each channel, see round_robin_workers.
+             * @param stealThreshold number of words in a ring of another worker that lets an
+             * idle worker consume it.
+             */
+            explicit basic_channel_aggregator(const std::vector<size_t> &channelWorkers,
+                                              size_t stealThreshold = RingCapacity / 2)
+              : steal_threshold_(std::max<size_t>(1, stealThreshold))
+            {
+                assert(channelWorkers.size() <= std::numeric_limits<uint16_t>::max() + size_t(1) &&
+                       "Too many channels!");
+
+                const size_t workersCount =
+                    channelWorkers.empty()
+                        ? 0
+                        : *std::max_element(channelWorkers.begin(), channelWorkers.end()) + 1;
+                workers_.resize(workersCount);
+                channels_.reserve(channelWorkers.size());
+                for (size_t channel = 0; channel < channelWorkers.size(); ++channel)
+                {
+                    channels_.push_back(std::make_unique<channel_state>());
+                    workers_[channelWorkers[channel]].push_back(channel);
+                }
+            }
+
+            size_t channels_count() const { return channels_.size(); }
+
+            size_t workers_count() const { return workers_.size(); }
+
+            size_t steal_threshold() const { return steal_threshold_; }
+
+            /**
+             * Ring of a channel. The producer of the channel pushes words into it.
+             */
+            ring_type &ring(size_t channel) { return channels_[channel]->ring; }
+
+            /**
+             * Latest words of a channel. May be read by any thread.
+             */
+            const cache_type &cache(size_t channel) const { return channels_[channel]->cache; }
+
+            /**
+             * Consume up to batchSize words of each channel of a worker, without a handler.
+             * @return number of consumed words.
+             */
+            size_t poll(size_t worker, size_t batchSize = RingCapacity)
+            {
+                detail::ignore_words handler{};
+                return poll(worker, handler, batchSize);
+            }
+
+            /**
+             * Consume up to batchSize words of each channel of a worker. If the worker has no
+             * words, consume channels of other workers that reached the steal threshold.
+             * @param handler callable with signature void(uint16_t channel, const WordT &) for
+             * each of the bound word types.
+             * @return number of consumed words.
+             */
+            template<typename Handler>
+            size_t poll(size_t worker, Handler &&handler, size_t batchSize = RingCapacity)
+            {
+                size_t consumed = 0;
+                for (const size_t channel : workers_[worker])
+                {
+                    consumed += consume(channel, handler, batchSize);
+                }
+                if (consumed != 0)
+                {
+                    return consumed;
+                }
+
+                for (size_t other = 1; other < workers_.size(); ++other)
+                {
+                    for (const size_t channel : workers_[(worker + other) % workers_.size()])
+                    {
+                        if (channels_[channel]->ring.size() >= steal_threshold_)
+                        {
+                            consumed += consume(channel, handler, batchSize);
+                        }
+                    }
+                }
+                return consumed;
+            }
+
+            /**
+             * Poll until stop is set, yielding while there are no words.
+             */
+            template<typename Handler>
+            void run(size_t worker, const std::atomic<bool> &stop, Handler &&handler)
+            {
+                while (!stop.load(std::memory_order_acquire))
+                {
+                    if (poll(worker, handler) == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            void run(size_t worker, const std::atomic<bool> &stop)
+            {
+                detail::ignore_words handler{};
+                run(worker, stop, handler);
+            }
+
+            /**
+             * Merge snapshots of the caches of all channels. Each channel snapshot is consistent
+             * and contains all words consumed before the call.
+             * @param out snapshot of each channel, resized to channels_count().
+             */
+            void snapshot(std::vector<cache_snapshot_type> &out) const
+            {
+                out.resize(channels_.size());
+                for (size_t channel = 0; channel < channels_.size(); ++channel)
+                {
+                    channels_[channel]->cache.snapshot(out[channel]);
+                }
+            }
+
+        private:
+            struct channel_state
+            {
+                ring_type ring;
+                cache_type cache;
+                /**
+                 * Set while a worker consumes the channel.
+                 */
+                alignas(detail::cache_line_size) std::atomic<bool> busy{ false };
+
+                /**
+                 * Over-aligned allocation, new of C++14 only guarantees alignment of max_align_t.
+                 */
+                static void *operator new(size_t size)
+                {
+#if defined(_WIN32)
+                    void *pointer = _aligned_malloc(size, alignof(channel_state));
+#else
+                    void *pointer = nullptr;
+                    if (posix_memalign(&pointer, alignof(channel_state), size) != 0)
+                    {
+                        pointer = nullptr;
+                    }
+#endif
+                    if (!pointer)
+                    {
+                        throw std::bad_alloc();
+                    }
+                    return pointer;
+                }
+
+                static void operator delete(void *pointer)
+                {
+#if defined(_WIN32)
+                    _aligned_free(pointer);
+#else
+                    std::free(pointer);
+#endif
+                }
+            };
+
+            template<typename Handler>
+            size_t consume(size_t channel, Handler &handler, size_t batchSize)
+            {
+                channel_state &state = *channels_[channel];
+                if (state.busy.exchange(true, std::memory_order_acquire))
+                {
+                    return 0;
+                }
+
+                const size_t consumed =
+                    state.ring.consume(batchSize,
+                                       [&](const traits::word_raw_type *words, size_t n) {
+                                           state.cache.update(words, n);
+                                           dispatch(words, n, uint16_t(channel), handler);
+                                       });
+                state.busy.store(false, std::memory_order_release);
+                return consumed;
+            }
+
+            template<typename Handler>
+            void dispatch(const traits::word_raw_type *words,
+                          size_t n,
+                          uint16_t channel,
+                          Handler &handler) const
+            {
+                dispatcher_.dispatch(words, n, detail::channel_handler<Handler>{ handler, channel });
+            }
+
+            void dispatch(const traits::word_raw_type *,
+                          size_t,
+                          uint16_t,
+                          detail::ignore_words &) const
+            {
+            }
+
+            std::vector<std::unique_ptr<channel_state>> channels_;
+            /**
+             * Channels of each worker.
+             */
+            std::vector<std::vector<size_t>> workers_;
+            size_t steal_threshold_;
+            dispatcher_type dispatcher_;
+        };
+
+        /**
+         * Aggregator with a cache slot per label and without instrumentation.
+         */
+        template<size_t RingCapacity, typename... LabelWords>
+        using channel_aggregator =
+            basic_channel_aggregator<RingCapacity, 1, null_instrumentation, LabelWords...>;
+
+        /**
+         * Aggregator with a cache slot per label and SDI and without instrumentation.
+         */
+        template<size_t RingCapacity, typename... LabelWords>
+        using sdi_channel_aggregator = basic_channel_aggregator<RingCapacity,
+                                                                detail::sdi_count,
+                                                                null_instrumentation,
+                                                                LabelWords...>;
+    }
+}
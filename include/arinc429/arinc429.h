@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include <climits>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <ratio>
@@ -10,6 +11,21 @@
 #include <cassert>
 #include <utility>
 
+#if defined(__has_builtin)
+#    if __has_builtin(__builtin_bitreverse8)
+#        define ELD_ARINC429_HAS_BITREVERSE8
+#    endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#    define ELD_ARINC429_HAS_BUILTIN_POPCOUNT
+#elif defined(__has_include)
+#    if __has_include(<bit>) && (__cplusplus >= 202002L || _MSVC_LANG >= 202002L)
+#        include <bit>
+#        define ELD_ARINC429_HAS_STD_POPCOUNT
+#    endif
+#endif
+
 /**
  * This is a header-only utility library for ARINC 429 data protocol.
  * The goals of this library are to provide (by priority):
@@ -83,24 +99,47 @@ namespace eld
                 return sum;
             }
 
-            template<typename /*Tuple*/, typename /*Pred*/>
-            struct filter;
+            template<size_t Index, typename NameType>
+            struct indexed_name
+            {
+            };
+
+            /**
+             * Set of names that derives from indexed_name<Index, NameType> for each of them.
+             * Index of a name is found by overload resolution against the bases, so a lookup
+             * does not instantiate anything per element.
+             */
+            template<typename /*IndexSequence*/, typename... NameTypes>
+            struct names_index;
+
+            template<size_t... Indexes, typename... NameTypes>
+            struct names_index<std::index_sequence<Indexes...>, NameTypes...>
+              : indexed_name<Indexes, NameTypes>...
+            {
+            };
+
+            template<typename NameType, size_t Index>
+            std::integral_constant<size_t, Index> name_index(const indexed_name<Index, NameType> &);
 
-            template<typename PlaceHolderT,
-                     typename... PredArgsT,
-                     typename... Ts,
-                     template<typename...>
-                     class Pred>
-            struct filter<std::tuple<Ts...>, Pred<PlaceHolderT, PredArgsT...>>
+            /**
+             * Index of NameType in a names_index. found is false if the name is missing or is
+             * not unique.
+             */
+            template<typename NameType, typename NamesIndex, typename = void>
+            struct find_name_index
             {
-                using type = decltype(std::tuple_cat(
-                    std::declval<typename std::conditional<Pred<Ts, PredArgsT...>::value,
-                                                           std::tuple<Ts>,
-                                                           std::tuple<>>::type>()...));
+                static constexpr bool found = false;
             };
 
-            template<typename Tuple, class Pred>
-            using filter_t = typename filter<Tuple, Pred>::type;
+            template<typename NameType, typename NamesIndex>
+            struct find_name_index<
+                NameType,
+                NamesIndex,
+                void_t<decltype(name_index<NameType>(std::declval<const NamesIndex &>()))>>
+              : decltype(name_index<NameType>(std::declval<const NamesIndex &>()))
+            {
+                static constexpr bool found = true;
+            };
 
         }
 
@@ -118,6 +157,23 @@ namespace eld
         {
         };
 
+        /**
+         * Scaling policy to be used as ScaleFactorT of a data descriptor instead of std::ratio.
+         * value = raw * Ratio, where the ratio is folded at compile time:
+         * - integral value types are scaled in integer arithmetic (shifts for power-of-two
+         * ratios, truncation towards zero);
+         * - floating point value types are scaled in the value type itself (no double
+         * conversion for float) and are encoded with a reciprocal multiply.
+         * @tparam Ratio std::ratio with positive numerator and denominator.
+         */
+        template<typename Ratio>
+        struct fixed_scale
+        {
+            using ratio = typename Ratio::type;
+
+            static_assert(ratio::num > 0 && ratio::den > 0, "Scale factor must be positive!");
+        };
+
         namespace traits
         {
             using word_raw_type = uint32_t;
@@ -247,43 +303,392 @@ namespace eld
                 using tuple_descriptors = typename WordT::tuple_descriptors;
             };
 
+            template<typename TupleDescriptors>
+            struct descriptors_index;
+
+            /**
+             * Index of data descriptor names, instantiated once per set of data descriptors.
+             */
+            template<typename... DataDescriptors>
+            struct descriptors_index<std::tuple<DataDescriptors...>>
+            {
+                using type = detail::names_index<std::index_sequence_for<DataDescriptors...>,
+                                                 name_type_t<DataDescriptors>...>;
+            };
+
+            template<typename TupleDescriptors>
+            using descriptors_index_t = typename descriptors_index<TupleDescriptors>::type;
+
+            template<typename NameType, typename TupleDescriptors>
+            struct count_names;
+
+            template<typename NameType, typename... DataDescriptors>
+            struct count_names<NameType, std::tuple<DataDescriptors...>>
+              : std::integral_constant<
+                    size_t,
+                    detail::sum(size_t(0),
+                                size_t(std::is_same<name_type_t<DataDescriptors>,
+                                                    NameType>::value)...)>
+            {
+            };
+
+            /**
+             * Check that names of data descriptors are unique.
+             */
+            template<typename TupleDescriptors>
+            struct are_names_unique;
+
+            template<typename... DataDescriptors>
+            struct are_names_unique<std::tuple<DataDescriptors...>>
+              : std::integral_constant<
+                    bool,
+                    detail::sum(
+                        size_t(0),
+                        size_t(detail::find_name_index<
+                               name_type_t<DataDescriptors>,
+                               descriptors_index_t<std::tuple<DataDescriptors...>>>::found)...) ==
+                        sizeof...(DataDescriptors)>
+            {
+            };
+
             template<typename NameType, typename WordType, typename NotFoundPlaceholder = void>
             class get_data_descriptor
             {
-                struct placeholder_t
-                {
-                    using name_type = void;
-                };
-                using filtered_t = detail::filter_t<typename WordType::tuple_descriptors,
-                                                    is_same_name_type<placeholder_t, NameType>>;
-                static_assert(!std::is_void<NotFoundPlaceholder>() ||
-                                  std::tuple_size<filtered_t>() != 0,
+                using tuple_descriptors = typename WordType::tuple_descriptors;
+                using lookup_t =
+                    detail::find_name_index<NameType, descriptors_index_t<tuple_descriptors>>;
+                // counted only if the lookup fails
+                using count_t = std::conditional_t<lookup_t::found,
+                                                   std::integral_constant<size_t, 1>,
+                                                   count_names<NameType, tuple_descriptors>>;
+
+                static_assert(!std::is_void<NotFoundPlaceholder>() || count_t::value != 0,
                               "Data descriptor not found!");
-                static_assert(std::tuple_size<filtered_t>() < 2,
+                static_assert(count_t::value < 2,
                               "Multiple data descriptors with same name were found");
 
+                template<typename LookupT, bool = LookupT::found>
+                struct select
+                {
+                    using type =
+                        typename std::tuple_element<LookupT::value, tuple_descriptors>::type;
+                };
+
+                template<typename LookupT>
+                struct select<LookupT, false>
+                {
+                    using type = NotFoundPlaceholder;
+                };
+
             public:
-                using type = typename std::tuple_element<0, filtered_t>::type;
+                using type = typename select<lookup_t>::type;
             };
 
             template<typename NameType, typename WordT, typename NotFoundPlaceholder = void>
             using get_data_descriptor_t =
                 typename get_data_descriptor<NameType, WordT, NotFoundPlaceholder>::type;
 
-            // TODO: ranges of defined bits
-            //            template <template <typename ...> class WordT, typename ...
-            //            DataDescriptors> struct definided_bits : std::index_sequence<>
-
         }
 
         namespace detail
         {
+            /**
+             * Compile-time masks and shifts for bit range [LSB, MSB]. Index starts with 1.
+             * @tparam LSB least significant bit.
+             * @tparam MSB most significant bit.
+             */
+            template<size_t LSB, size_t MSB>
+            struct bit_field
+            {
+                static_assert(LSB >= 1 && LSB <= MSB, "Invalid bit range!");
+                static_assert(MSB <= traits::word_size, "MSB exceeds maximum index");
+
+                static constexpr size_t width() { return MSB - LSB + 1; }
+
+                static constexpr size_t shift() { return LSB - 1; }
+
+                /**
+                 * Mask of the field bits after they are shifted to position 0.
+                 */
+                static constexpr traits::word_raw_type value_mask()
+                {
+                    return std::numeric_limits<traits::word_raw_type>::max() >>
+                           (traits::word_size - width());
+                }
+
+                /**
+                 * Mask of the field bits in place.
+                 */
+                static constexpr traits::word_raw_type mask() { return value_mask() << shift(); }
+
+                /**
+                 * The most significant bit of the field after it is shifted to position 0.
+                 */
+                static constexpr traits::word_raw_type sign_bit()
+                {
+                    return traits::word_raw_type(1) << (width() - 1);
+                }
+
+                static constexpr traits::word_raw_type extract(traits::word_raw_type wordRaw)
+                {
+                    return (wordRaw >> shift()) & value_mask();
+                }
+
+                static constexpr traits::word_raw_type insert(traits::word_raw_type wordRaw,
+                                                              traits::word_raw_type bits)
+                {
+                    return (wordRaw & ~mask()) | ((bits & value_mask()) << shift());
+                }
+            };
+
+            template<typename DataDescriptor>
+            using descriptor_bit_field_t =
+                bit_field<traits::data_descriptor_traits<DataDescriptor>::lsb(),
+                          traits::data_descriptor_traits<DataDescriptor>::msb()>;
+
+            constexpr traits::word_raw_type bitwise_or() { return 0; }
+
+            /**
+             * Calculate bitwise or of arguments.
+             */
+            template<typename... ArgsT>
+            constexpr traits::word_raw_type bitwise_or(traits::word_raw_type first, ArgsT... args)
+            {
+                return first | bitwise_or(args...);
+            }
+
+            constexpr bool are_disjoint() { return true; }
+
+            /**
+             * Check that no bit is set in more than one argument.
+             */
+            template<typename... ArgsT>
+            constexpr bool are_disjoint(traits::word_raw_type first, ArgsT... args)
+            {
+                return (first & bitwise_or(args...)) == 0 && are_disjoint(args...);
+            }
+
+            template<typename TupleDescriptors>
+            struct descriptors_masks;
+
+            template<typename... DataDescriptors>
+            struct descriptors_masks<std::tuple<DataDescriptors...>>
+            {
+                static constexpr traits::word_raw_type combined()
+                {
+                    return bitwise_or(descriptor_bit_field_t<DataDescriptors>::mask()...);
+                }
+
+                static constexpr bool disjoint()
+                {
+                    return are_disjoint(descriptor_bit_field_t<DataDescriptors>::mask()...);
+                }
+            };
+
+            /**
+             * Reverse order of bits by swapping nibbles, pairs and neighbouring bits.
+             */
+            constexpr uint8_t reverse_bits_swap(uint8_t value)
+            {
+                value = uint8_t((value & 0xf0) >> 4 | (value & 0x0f) << 4);
+                value = uint8_t((value & 0xcc) >> 2 | (value & 0x33) << 2);
+                return uint8_t((value & 0xaa) >> 1 | (value & 0x55) << 1);
+            }
+
+            struct bit_reverse_table
+            {
+                constexpr bit_reverse_table()   //
+                  : values{}
+                {
+                    for (size_t i = 0; i < 256; ++i)
+                    {
+                        values[i] = reverse_bits_swap(uint8_t(i));
+                    }
+                }
+
+                uint8_t values[256];
+            };
+
+            template<typename = void>
+            struct bit_reverse_lookup
+            {
+                static constexpr bit_reverse_table table{};
+            };
+
+            template<typename T>
+            constexpr bit_reverse_table bit_reverse_lookup<T>::table;
+
+            /**
+             * Reverse order of bits of an octet: with a builtin if available, otherwise with a
+             * lookup table.
+             */
+            constexpr uint8_t reverse_bits(uint8_t value)
+            {
+#if defined(ELD_ARINC429_HAS_BITREVERSE8)
+                return __builtin_bitreverse8(value);
+#else
+                return bit_reverse_lookup<>::table.values[value];
+#endif
+            }
+
+            /**
+             * Count set bits: with a builtin or std::popcount if available, otherwise with
+             * parallel bit counting.
+             */
+            constexpr size_t popcount(traits::word_raw_type value)
+            {
+#if defined(ELD_ARINC429_HAS_BUILTIN_POPCOUNT)
+                return size_t(__builtin_popcount(value));
+#elif defined(ELD_ARINC429_HAS_STD_POPCOUNT)
+                return size_t(std::popcount(value));
+#else
+                value = value - ((value >> 1) & 0x55555555);
+                value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+                return size_t((((value + (value >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24);
+#endif
+            }
+
+            /**
+             * @return 1 if number of set bits is odd, 0 otherwise.
+             */
+            constexpr traits::word_raw_type parity(traits::word_raw_type value)
+            {
+#if defined(ELD_ARINC429_HAS_BUILTIN_POPCOUNT)
+                return traits::word_raw_type(__builtin_parity(value));
+#else
+                return traits::word_raw_type(popcount(value) & 1);
+#endif
+            }
+
+            using sdi_field_t = bit_field<9, 10>;
+
+            constexpr size_t sdi_count = size_t(1) << sdi_field_t::width();
+
+            using ssm_field_t = bit_field<30, 31>;
+
+            using parity_field_t = bit_field<32, 32>;
+
+            constexpr traits::word_raw_type power_of_ten(size_t exponent)
+            {
+                return exponent == 0 ? 1 : 10 * power_of_ten(exponent - 1);
+            }
+
+            /**
+             * Decode binary-coded decimal digits. Digits are extracted in an unrolled expression.
+             * @param bits BCD digits, least significant digit in bits 0-3.
+             */
+            template<size_t... Digits>
+            constexpr traits::word_raw_type bcd_decode(traits::word_raw_type bits,
+                                                       std::index_sequence<Digits...>)
+            {
+                return sum(((bits >> (4 * Digits)) & 0xf) * power_of_ten(Digits)...);
+            }
+
+            /**
+             * Encode value as binary-coded decimal digits, least significant digit in bits 0-3.
+             */
+            template<size_t... Digits>
+            constexpr traits::word_raw_type bcd_encode(traits::word_raw_type value,
+                                                       std::index_sequence<Digits...>)
+            {
+                return bitwise_or(((value / power_of_ten(Digits)) % 10) << (4 * Digits)...);
+            }
+
+            constexpr bool is_power_of_two(intmax_t value)
+            {
+                return value > 0 && (value & (value - 1)) == 0;
+            }
+
+            constexpr size_t log2(intmax_t value) { return value > 1 ? 1 + log2(value / 2) : 0; }
+
+            template<typename Ratio>
+            using scale_kind_t = std::integral_constant<
+                int,
+                Ratio::den == 1 ? 1 : (Ratio::num == 1 && is_power_of_two(Ratio::den) ? 2 : 0)>;
+
+            /**
+             * Multiply by arbitrary Ratio, truncating towards zero.
+             */
+            template<typename Ratio>
+            constexpr int64_t scale_integral(int64_t value, std::integral_constant<int, 0>)
+            {
+                return value * Ratio::num / Ratio::den;
+            }
+
+            /**
+             * Multiply by integer Ratio.
+             */
+            template<typename Ratio>
+            constexpr int64_t scale_integral(int64_t value, std::integral_constant<int, 1>)
+            {
+                return value * Ratio::num;
+            }
+
+            /**
+             * Divide by power-of-two Ratio with a shift, truncating towards zero.
+             */
+            template<typename Ratio>
+            constexpr int64_t scale_integral(int64_t value, std::integral_constant<int, 2>)
+            {
+                return (value + (value < 0 ? Ratio::den - 1 : 0)) >> log2(Ratio::den);
+            }
+
+            /**
+             * Selects scaling of a data descriptor without constructing its scale factor type.
+             */
+            template<typename ScaleFactorT>
+            struct scale_tag
+            {
+            };
+
+            template<typename T>
+            struct is_fixed_scale : std::false_type
+            {
+            };
+
+            template<typename Ratio>
+            struct is_fixed_scale<fixed_scale<Ratio>> : std::true_type
+            {
+            };
+
+            template<typename Ratio, typename T, bool = std::is_floating_point<T>::value>
+            struct fixed_scaler
+            {
+                using inverse_ratio = std::ratio<Ratio::den, Ratio::num>;
+
+                static constexpr T to_value(int64_t rawValue)
+                {
+                    return T(scale_integral<Ratio>(rawValue, scale_kind_t<Ratio>()));
+                }
+
+                static constexpr int64_t to_raw(const T &value)
+                {
+                    return scale_integral<inverse_ratio>(int64_t(value),
+                                                         scale_kind_t<inverse_ratio>());
+                }
+            };
+
+            template<typename Ratio, typename T>
+            struct fixed_scaler<Ratio, T, true>
+            {
+                static constexpr T factor() { return T(Ratio::num) / T(Ratio::den); }
+
+                static constexpr T reciprocal() { return T(Ratio::den) / T(Ratio::num); }
+
+                static constexpr T to_value(int32_t rawValue) { return T(rawValue) * factor(); }
+
+                static constexpr int64_t to_raw(const T &value)
+                {
+                    return int32_t(value * reciprocal());
+                }
+            };
+
             template<typename T>
-            void get_integral_value(T &dest,
-                                    traits::word_raw_type wordRaw,
-                                    size_t lsb,
-                                    size_t msb,
-                                    std::false_type /*is_signed*/)
+            constexpr void get_integral_value(T &dest,
+                                              traits::word_raw_type wordRaw,
+                                              size_t lsb,
+                                              size_t msb,
+                                              std::false_type /*is_signed*/)
             {
                 uint8_t leftShift = 32 - msb;
                 uint8_t rightShift = lsb + leftShift - 1;
@@ -291,11 +696,11 @@ namespace eld
             }
 
             template<typename T>
-            void get_integral_value(T &dest,
-                                    traits::word_raw_type wordRaw,
-                                    size_t lsb,
-                                    size_t msb,
-                                    std::true_type /*is_signed*/)
+            constexpr void get_integral_value(T &dest,
+                                              traits::word_raw_type wordRaw,
+                                              size_t lsb,
+                                              size_t msb,
+                                              std::true_type /*is_signed*/)
             {
                 uint32_t sign_bit = 0;
                 get_integral_value(sign_bit, wordRaw, msb, msb, std::false_type{});
@@ -310,24 +715,24 @@ namespace eld
             }
 
             template<typename T>
-            void get_value(T &dest,
-                           traits::word_raw_type wordRaw,
-                           size_t lsb,
-                           size_t msb,
-                           double /*scaleFactor*/,
-                           std::false_type /*is_floating_point*/)
+            constexpr void get_value(T &dest,
+                                     traits::word_raw_type wordRaw,
+                                     size_t lsb,
+                                     size_t msb,
+                                     double /*scaleFactor*/,
+                                     std::false_type /*is_floating_point*/)
             {
                 static_assert(!std::is_floating_point<T>(), "Only integral types are expected!");
                 detail::get_integral_value(dest, wordRaw, lsb, msb, std::is_signed<T>());
             }
 
             template<typename T>
-            void get_value(T &dest,
-                           traits::word_raw_type wordRaw,
-                           size_t lsb,
-                           size_t msb,
-                           double scaleFactor,
-                           std::true_type /*is_floating_point*/)
+            constexpr void get_value(T &dest,
+                                     traits::word_raw_type wordRaw,
+                                     size_t lsb,
+                                     size_t msb,
+                                     double scaleFactor,
+                                     std::true_type /*is_floating_point*/)
             {
                 static_assert(std::is_floating_point<T>(),
                               "Only floating point types are expected!");
@@ -337,39 +742,111 @@ namespace eld
                 dest = raw_value * scaleFactor;
             }
 
+            /**
+             * Compile-time bit range version of get_integral_value: a single shift and mask.
+             */
+            template<size_t LSB, size_t MSB, typename T>
+            constexpr void get_integral_value(T &dest,
+                                              traits::word_raw_type wordRaw,
+                                              std::false_type /*is_signed*/)
+            {
+                dest = bit_field<LSB, MSB>::extract(wordRaw);
+            }
+
+            /**
+             * Compile-time bit range version of get_integral_value: shift, mask and sign-extend.
+             */
+            template<size_t LSB, size_t MSB, typename T>
+            constexpr void get_integral_value(T &dest,
+                                              traits::word_raw_type wordRaw,
+                                              std::true_type /*is_signed*/)
+            {
+                using field_t = bit_field<LSB, MSB>;
+                dest = int32_t((field_t::extract(wordRaw) ^ field_t::sign_bit()) -
+                               field_t::sign_bit());
+            }
+
+            template<size_t LSB, size_t MSB, typename T>
+            constexpr void get_value(T &dest,
+                                     traits::word_raw_type wordRaw,
+                                     double /*scaleFactor*/,
+                                     std::false_type /*is_floating_point*/)
+            {
+                static_assert(!std::is_floating_point<T>(), "Only integral types are expected!");
+                detail::get_integral_value<LSB, MSB>(dest, wordRaw, std::is_signed<T>());
+            }
+
+            template<size_t LSB, size_t MSB, typename T>
+            constexpr void get_value(T &dest,
+                                     traits::word_raw_type wordRaw,
+                                     double scaleFactor,
+                                     std::true_type /*is_floating_point*/)
+            {
+                static_assert(std::is_floating_point<T>(),
+                              "Only floating point types are expected!");
+
+                int32_t raw_value = 0;
+                get_integral_value<LSB, MSB>(raw_value, wordRaw, std::true_type{});
+                dest = raw_value * scaleFactor;
+            }
+
+            /**
+             * Scaling by any ScaleFactorT with num and den members, e.g. std::ratio.
+             */
+            template<size_t LSB, size_t MSB, typename T, typename ScaleFactorT>
+            constexpr void get_value(T &dest,
+                                     traits::word_raw_type wordRaw,
+                                     scale_tag<ScaleFactorT>)
+            {
+                get_value<LSB, MSB>(dest,
+                                    wordRaw,
+                                    double(ScaleFactorT::num) / ScaleFactorT::den,
+                                    std::is_floating_point<T>());
+            }
+
+            template<size_t LSB, size_t MSB, typename T, typename Ratio>
+            constexpr void get_value(T &dest,
+                                     traits::word_raw_type wordRaw,
+                                     scale_tag<fixed_scale<Ratio>>)
+            {
+                using raw_t = std::conditional_t<std::is_unsigned<T>::value, uint32_t, int32_t>;
+                using scaler_t = fixed_scaler<typename fixed_scale<Ratio>::ratio, T>;
+
+                raw_t raw_value = 0;
+                get_integral_value<LSB, MSB>(raw_value, wordRaw, std::is_signed<raw_t>());
+                dest = scaler_t::to_value(raw_value);
+            }
+
             template<typename DataDescriptor,
                      typename ValueType =
                          typename traits::data_descriptor_traits<DataDescriptor>::value_type>
-            void get_value(ValueType &retVal,
-                           traits::word_raw_type wordRaw,
-                           std::false_type /*defines_getter*/)
+            constexpr void get_value(ValueType &retVal,
+                                     traits::word_raw_type wordRaw,
+                                     std::false_type /*defines_getter*/)
             {
                 using traits_t = traits::data_descriptor_traits<DataDescriptor>;
                 using scale_factor_t = typename traits_t::scale_factor_type;
-                get_value(retVal,
-                          wordRaw,
-                          traits_t::lsb(),
-                          traits_t::msb(),
-                          double(scale_factor_t::num) / scale_factor_t::den,
-                          std::is_floating_point<ValueType>());
+                get_value<traits_t::lsb(), traits_t::msb()>(retVal,
+                                                            wordRaw,
+                                                            scale_tag<scale_factor_t>());
             }
 
             template<typename DataDescriptor,
                      typename ValueType =
                          typename traits::data_descriptor_traits<DataDescriptor>::value_type>
-            void get_value(ValueType &retVal,
-                           traits::word_raw_type wordRaw,
-                           std::true_type /*defines_getter*/)
+            constexpr void get_value(ValueType &retVal,
+                                     traits::word_raw_type wordRaw,
+                                     std::true_type /*defines_getter*/)
             {
                 DataDescriptor()(retVal, wordRaw, tag_get());
             }
 
             template<typename T>
-            void set_integral_value(const T &value,
-                                    traits::word_raw_type &wordRaw,
-                                    size_t lsb,
-                                    size_t msb,
-                                    std::false_type /*is_signed*/)
+            constexpr void set_integral_value(const T &value,
+                                              traits::word_raw_type &wordRaw,
+                                              size_t lsb,
+                                              size_t msb,
+                                              std::false_type /*is_signed*/)
             {
                 size_t unused_bit_count = 32 - (msb - lsb + 1);
                 uint32_t clamped_value = (uint32_t(value) << unused_bit_count) >> unused_bit_count;
@@ -385,11 +862,11 @@ namespace eld
             }
 
             template<typename T>
-            void set_integral_value(const T &value,
-                                    traits::word_raw_type &wordRaw,
-                                    size_t lsb,
-                                    size_t msb,
-                                    std::true_type /*is_signed*/)
+            constexpr void set_integral_value(const T &value,
+                                              traits::word_raw_type &wordRaw,
+                                              size_t lsb,
+                                              size_t msb,
+                                              std::true_type /*is_signed*/)
             {
                 set_integral_value(uint32_t(value), wordRaw, lsb, msb - 1, std::false_type{});
                 set_integral_value(uint32_t(value < 0 ? 1 : 0),
@@ -400,24 +877,24 @@ namespace eld
             }
 
             template<typename T>
-            void set_value(const T &value,
-                           traits::word_raw_type &wordRaw,
-                           size_t lsb,
-                           size_t msb,
-                           double /*scaleFactor*/,
-                           std::false_type /*is_floating_point*/)
+            constexpr void set_value(const T &value,
+                                     traits::word_raw_type &wordRaw,
+                                     size_t lsb,
+                                     size_t msb,
+                                     double /*scaleFactor*/,
+                                     std::false_type /*is_floating_point*/)
             {
                 static_assert(!std::is_floating_point<T>(), "Only integral types are expected!");
                 detail::set_integral_value(value, wordRaw, lsb, msb, std::is_signed<T>());
             }
 
             template<typename T>
-            void set_value(const T &value,
-                           traits::word_raw_type &wordRaw,
-                           size_t lsb,
-                           size_t msb,
-                           double scaleFactor,
-                           std::true_type /*is_floating_point*/)
+            constexpr void set_value(const T &value,
+                                     traits::word_raw_type &wordRaw,
+                                     size_t lsb,
+                                     size_t msb,
+                                     double scaleFactor,
+                                     std::true_type /*is_floating_point*/)
             {
                 static_assert(std::is_floating_point<T>(),
                               "Only floating point types are expected!");
@@ -425,44 +902,135 @@ namespace eld
                 set_value(int32_t(value / scaleFactor), wordRaw, lsb, msb, 1, std::false_type{});
             }
 
+            /**
+             * Compile-time bit range version of set_integral_value: a single masked store.
+             */
+            template<size_t LSB, size_t MSB, typename T>
+            constexpr void set_integral_value(const T &value,
+                                              traits::word_raw_type &wordRaw,
+                                              std::false_type /*is_signed*/)
+            {
+                wordRaw = bit_field<LSB, MSB>::insert(wordRaw, traits::word_raw_type(value));
+            }
+
+            /**
+             * Compile-time bit range version of set_integral_value. Lower bits receive the
+             * lower bits of the value and MSB receives the sign, same as the runtime version.
+             */
+            template<size_t LSB, size_t MSB, typename T>
+            constexpr void set_integral_value(const T &value,
+                                              traits::word_raw_type &wordRaw,
+                                              std::true_type /*is_signed*/)
+            {
+                using field_t = bit_field<LSB, MSB>;
+                const traits::word_raw_type bits =
+                    (traits::word_raw_type(value) & (field_t::sign_bit() - 1)) |
+                    (value < 0 ? field_t::sign_bit() : 0);
+                wordRaw = field_t::insert(wordRaw, bits);
+            }
+
+            template<size_t LSB, size_t MSB, typename T>
+            constexpr void set_value(const T &value,
+                                     traits::word_raw_type &wordRaw,
+                                     double /*scaleFactor*/,
+                                     std::false_type /*is_floating_point*/)
+            {
+                static_assert(!std::is_floating_point<T>(), "Only integral types are expected!");
+                detail::set_integral_value<LSB, MSB>(value, wordRaw, std::is_signed<T>());
+            }
+
+            template<size_t LSB, size_t MSB, typename T>
+            constexpr void set_value(const T &value,
+                                     traits::word_raw_type &wordRaw,
+                                     double scaleFactor,
+                                     std::true_type /*is_floating_point*/)
+            {
+                static_assert(std::is_floating_point<T>(),
+                              "Only floating point types are expected!");
+
+                set_integral_value<LSB, MSB>(int32_t(value / scaleFactor),
+                                             wordRaw,
+                                             std::true_type{});
+            }
+
+            /**
+             * Scaling by any ScaleFactorT with num and den members, e.g. std::ratio.
+             */
+            template<size_t LSB, size_t MSB, typename T, typename ScaleFactorT>
+            constexpr void set_value(const T &value,
+                                     traits::word_raw_type &wordRaw,
+                                     scale_tag<ScaleFactorT>)
+            {
+                set_value<LSB, MSB>(value,
+                                    wordRaw,
+                                    double(ScaleFactorT::num) / ScaleFactorT::den,
+                                    std::is_floating_point<T>());
+            }
+
+            template<size_t LSB, size_t MSB, typename T, typename Ratio>
+            constexpr void set_value(const T &value,
+                                     traits::word_raw_type &wordRaw,
+                                     scale_tag<fixed_scale<Ratio>>)
+            {
+                using raw_t = std::conditional_t<std::is_unsigned<T>::value, uint32_t, int32_t>;
+                using scaler_t = fixed_scaler<typename fixed_scale<Ratio>::ratio, T>;
+
+                set_integral_value<LSB, MSB>(raw_t(scaler_t::to_raw(value)),
+                                             wordRaw,
+                                             std::is_signed<raw_t>());
+            }
+
             template<typename DataDescriptor,
                      typename ValueType =
                          typename traits::data_descriptor_traits<DataDescriptor>::value_type>
-            void set_value(const ValueType &value,
-                           traits::word_raw_type &wordRaw,
-                           std::false_type /*defines_getter*/)
+            constexpr void set_value(const ValueType &value,
+                                     traits::word_raw_type &wordRaw,
+                                     std::false_type /*defines_getter*/)
             {
                 using traits_t = traits::data_descriptor_traits<DataDescriptor>;
                 using scale_factor_t = typename traits_t::scale_factor_type;
-                set_value(value,
-                          wordRaw,
-                          traits_t::lsb(),
-                          traits_t::msb(),
-                          double(scale_factor_t::num) / scale_factor_t::den,
-                          std::is_floating_point<ValueType>());
+                set_value<traits_t::lsb(), traits_t::msb()>(value,
+                                                            wordRaw,
+                                                            scale_tag<scale_factor_t>());
             }
 
             template<typename DataDescriptor,
                      typename ValueType =
                          typename traits::data_descriptor_traits<DataDescriptor>::value_type>
-            void set_value(const ValueType &value,
-                           traits::word_raw_type &wordRaw,
-                           std::true_type /*defines_getter*/)
+            constexpr void set_value(const ValueType &value,
+                                     traits::word_raw_type &wordRaw,
+                                     std::true_type /*defines_getter*/)
             {
                 DataDescriptor()(value, wordRaw, tag_set());
             }
 
-        }
-
-        template<
-            typename T,
+            /**
+             * Encode value into an otherwise empty word.
+             * @return raw word with only the bits of DataDescriptor set.
+             */
+            template<typename DataDescriptor,
+                     typename ValueType =
+                         typename traits::data_descriptor_traits<DataDescriptor>::value_type>
+            constexpr traits::word_raw_type encode_value(const ValueType &value)
+            {
+                traits::word_raw_type wordRaw = 0;
+                set_value<DataDescriptor>(value,
+                                          wordRaw,
+                                          traits::defines_setter<DataDescriptor, ValueType>());
+                return wordRaw;
+            }
+
+        }
+
+        template<
+            typename T,
             typename = typename std::enable_if<
                 detail::disjunction<std::is_floating_point<T>, std::is_integral<T>>::value>::type>
-        void get_value(T &destination,
-                       traits::word_raw_type wordRaw,
-                       size_t lsb,
-                       size_t msb,
-                       double scaleFactor = 1.0)
+        constexpr void get_value(T &destination,
+                                 traits::word_raw_type wordRaw,
+                                 size_t lsb,
+                                 size_t msb,
+                                 double scaleFactor = 1.0)
         {
             detail::get_value(destination,
                               wordRaw,
@@ -475,7 +1043,7 @@ namespace eld
         template<typename DataDescriptor,
                  typename ValueType =
                      typename traits::data_descriptor_traits<DataDescriptor>::value_type>
-        void get_value(ValueType &retVal, traits::word_raw_type wordRaw)
+        constexpr void get_value(ValueType &retVal, traits::word_raw_type wordRaw)
         {
             detail::get_value<DataDescriptor>(retVal,
                                               wordRaw,
@@ -486,11 +1054,11 @@ namespace eld
             typename T,
             typename = typename std::enable_if<
                 detail::disjunction<std::is_floating_point<T>, std::is_integral<T>>::value>::type>
-        void set_value(const T &value,
-                       traits::word_raw_type &wordRaw,
-                       size_t lsb,
-                       size_t msb,
-                       double scaleFactor = 1.0)
+        constexpr void set_value(const T &value,
+                                 traits::word_raw_type &wordRaw,
+                                 size_t lsb,
+                                 size_t msb,
+                                 double scaleFactor = 1.0)
         {
             detail::set_value(value, wordRaw, lsb, msb, scaleFactor, std::is_floating_point<T>());
         }
@@ -498,56 +1066,109 @@ namespace eld
         template<typename DataDescriptor,
                  typename ValueType =
                      typename traits::data_descriptor_traits<DataDescriptor>::value_type>
-        void set_value(const ValueType &value, traits::word_raw_type &wordRaw)
+        constexpr void set_value(const ValueType &value, traits::word_raw_type &wordRaw)
         {
             detail::set_value<DataDescriptor>(value,
                                               wordRaw,
                                               traits::defines_setter<DataDescriptor, ValueType>());
         }
 
+        namespace traits
+        {
+            /**
+             * Mask of all bits covered by data descriptors of WordT.
+             */
+            template<typename WordT>
+            struct defined_bits_mask
+              : std::integral_constant<
+                    word_raw_type,
+                    detail::descriptors_masks<typename word_traits<WordT>::tuple_descriptors>::
+                        combined()>
+            {
+            };
+
+            /**
+             * Mask of the bits of data with NameType in WordT.
+             */
+            template<typename NameType, typename WordT>
+            struct field_mask
+              : std::integral_constant<
+                    word_raw_type,
+                    detail::descriptor_bit_field_t<get_data_descriptor_t<NameType, WordT>>::mask()>
+            {
+            };
+        }
+
+        /**
+         * Compute ARINC 429 odd parity bit (bit 32) for bits 1-31 of a raw word.
+         * @return value of the parity bit: 1 if number of set data bits is even, 0 otherwise.
+         */
+        constexpr traits::word_raw_type compute_parity(traits::word_raw_type wordRaw)
+        {
+            return detail::parity(wordRaw & ~detail::parity_field_t::mask()) ^ 1;
+        }
+
+        /**
+         * Check ARINC 429 odd parity of a raw word.
+         * @return true if number of set bits (including parity bit) is odd.
+         */
+        constexpr bool validate_parity(traits::word_raw_type wordRaw)
+        {
+            return detail::parity(wordRaw) == 1;
+        }
+
+        namespace detail
+        {
+            /**
+             * Raw word of a word_generic. A word adds neither data members nor virtual or copy
+             * functions, so it has the size and the copy semantics of its storage.
+             */
+            struct word_storage
+            {
+                traits::word_raw_type raw_word_;
+            };
+        }
+
         /**
          * Generic class used to define types for custom ARINC 429 words.
          * @tparam DataDescriptors
          */
         template<typename... DataDescriptors>
-        class word_generic
+        class word_generic : private detail::word_storage
         {
-            static_assert(detail::sum(traits::data_descriptor_traits<DataDescriptors>::msb() -
-                                      traits::data_descriptor_traits<DataDescriptors>::lsb()...) <=
-                              traits::word_size,
-                          "Size of data exceeds size of arinc 429 word!");
+            static_assert(detail::descriptors_masks<std::tuple<DataDescriptors...>>::disjoint(),
+                          "Data descriptors overlap!");
 
-            using word_type_t = word_generic<DataDescriptors...>;
+            static_assert(traits::are_names_unique<std::tuple<DataDescriptors...>>(),
+                          "Multiple data descriptors with same name were found");
 
-            // TODO: check that struct types are unique
+            // words are stored and copied as raw words, e.g. with memcpy or DMA; checked on the
+            // storage, the word itself is incomplete here
+            static_assert(sizeof(detail::word_storage) == sizeof(traits::word_raw_type),
+                          "Word must have the size of a raw word!");
+            static_assert(std::is_trivially_copyable<detail::word_storage>::value,
+                          "Word must be trivially copyable!");
+            static_assert(std::is_standard_layout<detail::word_storage>::value,
+                          "Word must have standard layout!");
+
+            using word_type_t = word_generic<DataDescriptors...>;
 
         public:
             using tuple_descriptors = std::tuple<DataDescriptors...>;
 
             constexpr explicit word_generic(traits::word_raw_type rawWord)   //
-              : raw_word_(rawWord)
+              : detail::word_storage{ rawWord }
             {
             }
 
             constexpr word_generic() = default;
 
-            word_generic(const word_generic &) = default;
-            word_generic(word_generic &&) noexcept = default;
-
-            word_generic &operator=(const word_generic &) = default;
-            word_generic &operator=(word_generic &&) noexcept = default;
-
             // TODO: implement get and set via index, struct type (name) and string name
             template<typename NameType,
                      typename = typename std::enable_if<true /*TODO: implement*/>::type>
-            constexpr auto get()
+            constexpr auto get() const
             {
-                using data_descriptor_t = traits::get_data_descriptor_t<NameType, word_type_t>;
-
-                typename data_descriptor_t::value_type retVal{};
-                arinc429::get_value<data_descriptor_t>(retVal, raw_word_);
-
-                return retVal;
+                return get_data<traits::get_data_descriptor_t<NameType, word_type_t>>();
             }
 
             template<
@@ -563,20 +1184,87 @@ namespace eld
                 arinc429::set_value<data_descriptor_t>(value, raw_word_);
             }
 
-            traits::word_raw_type get_raw() const { return raw_word_; }
+            /**
+             * Get values of all data in order of DataDescriptors.
+             */
+            constexpr std::tuple<traits::value_type_t<DataDescriptors>...> get_all() const
+            {
+                return std::tuple<traits::value_type_t<DataDescriptors>...>(
+                    get_data<DataDescriptors>()...);
+            }
+
+            /**
+             * Set values of all data in order of DataDescriptors with a single masked store.
+             * Bits not covered by any data descriptor are preserved.
+             */
+            constexpr void set_all(const traits::value_type_t<DataDescriptors> &...values)
+            {
+                raw_word_ = (raw_word_ & ~traits::defined_bits_mask<word_type_t>()) |
+                            detail::bitwise_or(detail::encode_value<DataDescriptors>(values)...);
+            }
+
+            /**
+             * Set values of all data from a tuple in order of DataDescriptors.
+             */
+            constexpr void set_from(
+                const std::tuple<traits::value_type_t<DataDescriptors>...> &values)
+            {
+                set_from(values, std::index_sequence_for<DataDescriptors...>());
+            }
+
+            /**
+             * Check that no bits outside of DataDescriptors are set.
+             */
+            constexpr bool validate() const
+            {
+                return (raw_word_ & ~traits::defined_bits_mask<word_type_t>()) == 0;
+            }
 
-            void set_raw(traits::word_raw_type rawWord) { raw_word_ = rawWord; }
+            /**
+             * Reset all bits outside of DataDescriptors.
+             */
+            constexpr void clear_undefined()
+            {
+                raw_word_ &= traits::defined_bits_mask<word_type_t>();
+            }
 
-            explicit operator traits::word_raw_type() const { return get_raw(); }
+            /**
+             * Set parity bit (bit 32) according to the other bits of the word. Should be called
+             * after all data is set.
+             */
+            constexpr void finalize()
+            {
+                raw_word_ = detail::parity_field_t::insert(raw_word_, compute_parity(raw_word_));
+            }
+
+            constexpr traits::word_raw_type get_raw() const { return raw_word_; }
+
+            constexpr void set_raw(traits::word_raw_type rawWord) { raw_word_ = rawWord; }
+
+            constexpr explicit operator traits::word_raw_type() const { return get_raw(); }
 
             template<typename... ArgsT>
-            explicit operator word_generic<ArgsT...>() const
+            constexpr explicit operator word_generic<ArgsT...>() const
             {
                 return word_generic<ArgsT...>(get_raw());
             }
 
         private:
-            traits::word_raw_type raw_word_;
+            template<typename DataDescriptor>
+            constexpr traits::value_type_t<DataDescriptor> get_data() const
+            {
+                traits::value_type_t<DataDescriptor> retVal{};
+                arinc429::get_value<DataDescriptor>(retVal, raw_word_);
+                return retVal;
+            }
+
+            template<size_t... Indexes>
+            constexpr void set_from(
+                const std::tuple<traits::value_type_t<DataDescriptors>...> &values,
+                std::index_sequence<Indexes...>)
+            {
+                set_all(std::get<Indexes>(values)...);
+            }
         };
 
         // TODO: add customization for data retrieval.
@@ -613,18 +1301,258 @@ namespace eld
             using scale_factor_type = ScaleFactorT;
         };
 
+        /**
+         * Data descriptor of a label, which occupies bits 1-8 and is transmitted most significant
+         * bit first. The octet is bit-reversed on get and set, so values are label numbers
+         * (usually written in octal).
+         */
+        template<typename NameType>
+        struct label_descriptor : data_descriptor<NameType, 1, 8, uint8_t>
+        {
+            constexpr void operator()(uint8_t &dest, traits::word_raw_type wordRaw, tag_get) const
+            {
+                dest = detail::reverse_bits(uint8_t(detail::bit_field<1, 8>::extract(wordRaw)));
+            }
+
+            constexpr void operator()(uint8_t value, traits::word_raw_type &wordRaw, tag_set) const
+            {
+                wordRaw = detail::bit_field<1, 8>::insert(wordRaw, detail::reverse_bits(value));
+            }
+        };
+
+        /**
+         * Resolution of a BNR value from its range and number of significant bits.
+         */
+        template<typename RangeT, size_t SignificantBits>
+        using bnr_resolution_t =
+            std::ratio_divide<RangeT, std::ratio<intmax_t(1) << SignificantBits>>;
+
+        /**
+         * Data descriptor of a BNR (two's complement binary) value, with SignificantBits data
+         * bits ending at bit 28 and the sign at bit 29. SSM (bits 30-31) is a separate data.
+         * @tparam SignificantBits number of data bits, excluding sign.
+         * @tparam ResolutionT value of the least significant bit, std::ratio or fixed_scale.
+         */
+        template<typename NameType,
+                 size_t SignificantBits,
+                 typename ResolutionT = std::ratio<1>,
+                 typename ValueType = double>
+        struct bnr_descriptor :
+          data_descriptor<NameType, 29 - SignificantBits, 29, ValueType, ResolutionT>
+        {
+            static_assert(SignificantBits >= 1 && SignificantBits <= 28,
+                          "BNR data bits must be within bits 1-28!");
+            static_assert(std::is_signed<ValueType>(), "BNR value type must be signed!");
+        };
+
+        /**
+         * Data descriptor of BCD (binary-coded decimal) value. Digits are 4 bits wide starting
+         * from LSB. The most significant digit may be narrower (e.g. 3 bits for bits 11-29).
+         * Sign of BCD data is defined by SSM (bits 30-31), which is a separate data.
+         */
+        template<typename NameType, size_t LSB, size_t MSB, typename ValueType = uint32_t>
+        struct bcd_descriptor : data_descriptor<NameType, LSB, MSB, ValueType>
+        {
+            static_assert(std::is_integral<ValueType>(), "BCD value type must be integral!");
+
+            /**
+             * Get number of decimal digits.
+             */
+            static constexpr size_t digits() { return (MSB - LSB + 4) / 4; }
+
+            constexpr void operator()(ValueType &dest, traits::word_raw_type wordRaw, tag_get) const
+            {
+                dest = ValueType(detail::bcd_decode(detail::bit_field<LSB, MSB>::extract(wordRaw),
+                                                    std::make_index_sequence<digits()>()));
+            }
+
+            constexpr void operator()(ValueType value, traits::word_raw_type &wordRaw, tag_set) const
+            {
+                wordRaw = detail::bit_field<LSB, MSB>::insert(
+                    wordRaw,
+                    detail::bcd_encode(traits::word_raw_type(value),
+                                       std::make_index_sequence<digits()>()));
+            }
+        };
+
+        /**
+         * Data descriptor of a single discrete bit.
+         */
+        template<typename NameType, size_t Bit>
+        struct discrete_descriptor : data_descriptor<NameType, Bit, Bit, bool>
+        {
+        };
+
+        /**
+         * Data descriptor of SDI (source/destination identifier), bits 9-10.
+         */
+        template<typename NameType>
+        struct sdi_descriptor : data_descriptor<NameType, 9, 10, uint8_t>
+        {
+        };
+
+        /**
+         * Data descriptor of SSM (sign/status matrix), bits 30-31. Meaning of the codes depends
+         * on the encoding of data, e.g. bnr_ssm for BNR data.
+         */
+        template<typename NameType>
+        struct ssm_descriptor : data_descriptor<NameType, 30, 31, uint8_t>
+        {
+        };
+
+        /**
+         * Data descriptor of the parity bit, bit 32.
+         */
+        template<typename NameType>
+        struct parity_descriptor : data_descriptor<NameType, 32, 32, uint8_t>
+        {
+        };
+
+        /**
+         * SSM codes of BNR data.
+         */
+        enum class bnr_ssm : uint8_t
+        {
+            failure_warning = 0,
+            no_computed_data = 1,
+            functional_test = 2,
+            normal_operation = 3
+        };
+
+        /**
+         * Set of SSM codes: bit code is set for each code.
+         */
+        constexpr uint8_t ssm_mask() { return 0; }
+
+        template<typename... ArgsT>
+        constexpr uint8_t ssm_mask(bnr_ssm first, ArgsT... args)
+        {
+            return uint8_t((1u << uint8_t(first)) | ssm_mask(args...));
+        }
+
+        constexpr uint8_t any_ssm = 0xf;
+
+        /**
+         * BNR data that is neither failure warning nor no computed data.
+         */
+        constexpr uint8_t bnr_valid_ssm =
+            ssm_mask(bnr_ssm::functional_test, bnr_ssm::normal_operation);
+
+        namespace detail
+        {
+            /**
+             * Unsigned integral data with default (de)serialization is modified in place, in the
+             * bits of its field. Other data is decoded, modified and encoded back.
+             */
+            template<typename DataDescriptor>
+            using is_modifiable_in_place_t = std::integral_constant<
+                bool,
+                std::is_unsigned<traits::value_type_t<DataDescriptor>>::value &&
+                    !is_fixed_scale<traits::scale_factor_type_t<DataDescriptor>>::value &&
+                    !traits::defines_getter<DataDescriptor,
+                                            traits::value_type_t<DataDescriptor>>() &&
+                    !traits::defines_setter<DataDescriptor,
+                                            traits::value_type_t<DataDescriptor>>() &&
+                    descriptor_bit_field_t<DataDescriptor>::width() <=
+                        size_t(std::numeric_limits<traits::value_type_t<DataDescriptor>>::digits)>;
+
+            /**
+             * bool data is saturated by addition, so it is not added in place.
+             */
+            template<typename DataDescriptor>
+            using is_addable_in_place_t = std::integral_constant<
+                bool,
+                is_modifiable_in_place_t<DataDescriptor>::value &&
+                    !std::is_same<traits::value_type_t<DataDescriptor>, bool>::value>;
+
+            /**
+             * Operations of modifier. in_place takes the operand shifted to the field and keeps
+             * bits outside of the field, wrapping around within the field as the value would.
+             */
+            struct modify_add
+            {
+                template<typename BitFieldT>
+                static constexpr traits::word_raw_type in_place(traits::word_raw_type wordRaw,
+                                                                traits::word_raw_type operand)
+                {
+                    // carries out of the field are masked away
+                    return (wordRaw & ~BitFieldT::mask()) |
+                           ((wordRaw + operand) & BitFieldT::mask());
+                }
+
+                template<typename T>
+                static void apply(T &value, const T &operand)
+                {
+                    value += operand;
+                }
+            };
+
+            struct modify_sub
+            {
+                template<typename BitFieldT>
+                static constexpr traits::word_raw_type in_place(traits::word_raw_type wordRaw,
+                                                                traits::word_raw_type operand)
+                {
+                    // operand has no bits below the field, so borrows start within the field
+                    return (wordRaw & ~BitFieldT::mask()) |
+                           ((wordRaw - operand) & BitFieldT::mask());
+                }
+
+                template<typename T>
+                static void apply(T &value, const T &operand)
+                {
+                    value -= operand;
+                }
+            };
+
+            struct modify_or
+            {
+                template<typename BitFieldT>
+                static constexpr traits::word_raw_type in_place(traits::word_raw_type wordRaw,
+                                                                traits::word_raw_type operand)
+                {
+                    return wordRaw | (operand & BitFieldT::mask());
+                }
+
+                template<typename T>
+                static void apply(T &value, const T &operand)
+                {
+                    value |= operand;
+                }
+            };
+
+            struct modify_and
+            {
+                template<typename BitFieldT>
+                static constexpr traits::word_raw_type in_place(traits::word_raw_type wordRaw,
+                                                                traits::word_raw_type operand)
+                {
+                    return wordRaw & (~BitFieldT::mask() | operand);
+                }
+
+                template<typename T>
+                static void apply(T &value, const T &operand)
+                {
+                    value &= operand;
+                }
+            };
+        }
+
         /**
          * Helper class to facilitate "direct" data modification.
+         * Unsigned integral data with default (de)serialization is modified in the bits of its
+         * field without decoding.
          * @tparam NameType
          * @tparam WordType
          */
         template<typename NameType, typename WordType>
         class modifier
         {
+            using data_descriptor_t = traits::get_data_descriptor_t<NameType, WordType>;
+
         public:
             using name_type = NameType;
-            using value_type =
-                traits::value_type_t<traits::get_data_descriptor_t<NameType, WordType>>;
+            using value_type = traits::value_type_t<data_descriptor_t>;
             using word_type = WordType;
 
             static_assert(!std::is_void<value_type>(), "Word does not contain NameType");
@@ -636,9 +1564,8 @@ namespace eld
                 typename = typename std::enable_if<std::is_same<value_type, ValueT>::value>::type>
             modifier &operator+=(const ValueT &a_val)
             {
-                value_type val = word_.template get<name_type>();
-                val += a_val;
-                word_.template set<name_type>(val);
+                apply<detail::modify_add>(a_val,
+                                          detail::is_addable_in_place_t<data_descriptor_t>());
                 return *this;
             }
 
@@ -647,9 +1574,8 @@ namespace eld
                 typename = typename std::enable_if<std::is_same<value_type, ValueT>::value>::type>
             modifier &operator-=(const ValueT &a_val)
             {
-                value_type val = word_.template get<name_type>();
-                val -= a_val;
-                word_.template set<name_type>(val);
+                apply<detail::modify_sub>(a_val,
+                                          detail::is_addable_in_place_t<data_descriptor_t>());
                 return *this;
             }
 
@@ -658,9 +1584,8 @@ namespace eld
                 typename = typename std::enable_if<std::is_same<value_type, ValueT>::value>::type>
             modifier &operator|=(const ValueT &a_val)
             {
-                value_type val = word_.template get<name_type>();
-                val |= a_val;
-                word_.template set<name_type>(val);
+                apply<detail::modify_or>(a_val,
+                                         detail::is_modifiable_in_place_t<data_descriptor_t>());
                 return *this;
             }
 
@@ -668,15 +1593,102 @@ namespace eld
                 typename ValueT,
                 typename = typename std::enable_if<std::is_same<value_type, ValueT>::value>::type>
             modifier &operator&=(const ValueT &a_val)
+            {
+                apply<detail::modify_and>(a_val,
+                                          detail::is_modifiable_in_place_t<data_descriptor_t>());
+                return *this;
+            }
+
+        private:
+            template<typename OpT>
+            void apply(const value_type &a_val, std::true_type /*in place*/)
+            {
+                using bit_field_t = detail::descriptor_bit_field_t<data_descriptor_t>;
+
+                word_.set_raw(OpT::template in_place<bit_field_t>(
+                    word_.get_raw(),
+                    traits::word_raw_type(a_val) << bit_field_t::shift()));
+            }
+
+            template<typename OpT>
+            void apply(const value_type &a_val, std::false_type /*in place*/)
             {
                 value_type val = word_.template get<name_type>();
-                val &= a_val;
+                OpT::apply(val, a_val);
                 word_.template set<name_type>(val);
+            }
+
+            word_type &word_;
+        };
+
+        /**
+         * Modifies data with NameType of each word of a range.
+         * @tparam NameType
+         * @tparam WordType
+         */
+        template<typename NameType, typename WordType>
+        class batch_modifier
+        {
+            using modifier_t = modifier<NameType, WordType>;
+
+        public:
+            using name_type = NameType;
+            using value_type = typename modifier_t::value_type;
+            using word_type = WordType;
+
+            constexpr batch_modifier(word_type *words, size_t n) : words_(words), n_(n) {}
+
+            template<
+                typename ValueT,
+                typename = typename std::enable_if<std::is_same<value_type, ValueT>::value>::type>
+            batch_modifier &operator+=(const ValueT &a_val)
+            {
+                for (size_t i = 0; i < n_; ++i)
+                {
+                    modifier_t(words_[i]) += a_val;
+                }
+                return *this;
+            }
+
+            template<
+                typename ValueT,
+                typename = typename std::enable_if<std::is_same<value_type, ValueT>::value>::type>
+            batch_modifier &operator-=(const ValueT &a_val)
+            {
+                for (size_t i = 0; i < n_; ++i)
+                {
+                    modifier_t(words_[i]) -= a_val;
+                }
+                return *this;
+            }
+
+            template<
+                typename ValueT,
+                typename = typename std::enable_if<std::is_same<value_type, ValueT>::value>::type>
+            batch_modifier &operator|=(const ValueT &a_val)
+            {
+                for (size_t i = 0; i < n_; ++i)
+                {
+                    modifier_t(words_[i]) |= a_val;
+                }
+                return *this;
+            }
+
+            template<
+                typename ValueT,
+                typename = typename std::enable_if<std::is_same<value_type, ValueT>::value>::type>
+            batch_modifier &operator&=(const ValueT &a_val)
+            {
+                for (size_t i = 0; i < n_; ++i)
+                {
+                    modifier_t(words_[i]) &= a_val;
+                }
                 return *this;
             }
 
         private:
-            word_type &word_;
+            word_type *words_;
+            size_t n_;
         };
 
         template<typename NameType, typename WordType>
@@ -685,5 +1697,11 @@ namespace eld
             return modifier<NameType, WordType>(word);
         }
 
+        template<typename NameType, typename WordType>
+        batch_modifier<NameType, WordType> modify(WordType *words, size_t n)
+        {
+            return batch_modifier<NameType, WordType>(words, n);
+        }
+
     }
 }
\ No newline at end of file
@@ -0,0 +1,728 @@
+﻿#pragma once
+
+#include "arinc429/arinc429.h"
+
+#include <cstring>
+
+#if !defined(ELD_ARINC429_NO_SIMD)
+#    if defined(__AVX2__)
+#        define ELD_ARINC429_AVX2
+#        define ELD_ARINC429_SSE2
+#        include <immintrin.h>
+#    elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define ELD_ARINC429_SSE2
+#        include <emmintrin.h>
+#    elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#        define ELD_ARINC429_NEON
+#        include <arm_neon.h>
+#    endif
+#endif
+
+#if defined(ELD_ARINC429_SSE2) || defined(ELD_ARINC429_NEON)
+#    define ELD_ARINC429_SIMD
+#endif
+
+/**
+ * Batch encoding and decoding of contiguous buffers of raw ARINC 429 words.
+ * Explicit SIMD kernels are selected at compile time from the target instruction set
+ * (AVX2, SSE2 or NEON). Define ELD_ARINC429_NO_SIMD to use the scalar loops only.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        namespace detail
+        {
+            /**
+             * Explicit SIMD kernels are used for default (de)serialization of 32-bit integral
+             * values. Everything else goes through the auto-vectorizable scalar loop.
+             */
+#if defined(ELD_ARINC429_SIMD)
+            constexpr bool simd_available = true;
+#else
+            constexpr bool simd_available = false;
+#endif
+
+            template<typename DataDescriptor, typename ValueType>
+            using is_simd_compatible_t = std::integral_constant<
+                bool,
+                simd_available &&   //
+                    std::is_integral<ValueType>::value &&
+                    sizeof(ValueType) == sizeof(traits::word_raw_type) &&
+                    !is_fixed_scale<traits::scale_factor_type_t<DataDescriptor>>::value>;
+
+            template<typename DataDescriptor, typename ValueType>
+            using use_simd_decode_t = conjunction<
+                is_simd_compatible_t<DataDescriptor, ValueType>,
+                std::integral_constant<bool,
+                                       !traits::defines_getter<DataDescriptor, ValueType>()>>;
+
+            template<typename DataDescriptor, typename ValueType>
+            using use_simd_encode_t = conjunction<
+                is_simd_compatible_t<DataDescriptor, ValueType>,
+                std::integral_constant<bool,
+                                       !traits::defines_setter<DataDescriptor, ValueType>()>>;
+
+            template<typename DataDescriptor, typename ValueType>
+            void decode_batch(const traits::word_raw_type *in,
+                              size_t n,
+                              ValueType *out,
+                              std::false_type /*use_simd_kernel*/)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    arinc429::get_value<DataDescriptor>(out[i], in[i]);
+                }
+            }
+
+            template<typename DataDescriptor, typename ValueType>
+            void encode_batch(const ValueType *in,
+                              size_t n,
+                              traits::word_raw_type *out,
+                              std::false_type /*use_simd_kernel*/)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    arinc429::set_value<DataDescriptor>(in[i], out[i]);
+                }
+            }
+
+#if defined(ELD_ARINC429_SIMD)
+            /**
+             * Decode unsigned field [LSB, MSB] of the leading words of the buffer.
+             * @return number of words processed.
+             */
+            template<size_t LSB, size_t MSB, typename ValueType>
+            size_t decode_simd(const traits::word_raw_type *in,
+                               size_t n,
+                               ValueType *out,
+                               std::false_type /*is_signed*/)
+            {
+                using field_t = bit_field<LSB, MSB>;
+                size_t i = 0;
+#if defined(ELD_ARINC429_AVX2)
+                const __m256i mask256 = _mm256_set1_epi32(int(field_t::value_mask()));
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+                    words = _mm256_and_si256(_mm256_srli_epi32(words, int(field_t::shift())),
+                                             mask256);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), words);
+                }
+#endif
+#if defined(ELD_ARINC429_SSE2)
+                const __m128i mask128 = _mm_set1_epi32(int(field_t::value_mask()));
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                    words = _mm_and_si128(_mm_srli_epi32(words, int(field_t::shift())), mask128);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), words);
+                }
+#endif
+#if defined(ELD_ARINC429_NEON)
+                const uint32x4_t mask = vdupq_n_u32(field_t::value_mask());
+                const int32x4_t shift = vdupq_n_s32(-int(field_t::shift()));
+                for (; i + 4 <= n; i += 4)
+                {
+                    uint32x4_t words = vandq_u32(vshlq_u32(vld1q_u32(in + i), shift), mask);
+                    vst1q_u32(reinterpret_cast<uint32_t *>(out + i), words);
+                }
+#endif
+                return i;
+            }
+
+            /**
+             * Decode signed field [LSB, MSB] of the leading words of the buffer.
+             * The field is shifted to the top of the lane and arithmetically shifted back.
+             * @return number of words processed.
+             */
+            template<size_t LSB, size_t MSB, typename ValueType>
+            size_t decode_simd(const traits::word_raw_type *in,
+                               size_t n,
+                               ValueType *out,
+                               std::true_type /*is_signed*/)
+            {
+                using field_t = bit_field<LSB, MSB>;
+                constexpr int left_shift = int(traits::word_size - MSB);
+                constexpr int right_shift = int(traits::word_size - field_t::width());
+                size_t i = 0;
+#if defined(ELD_ARINC429_AVX2)
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+                    words = _mm256_srai_epi32(_mm256_slli_epi32(words, left_shift), right_shift);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), words);
+                }
+#endif
+#if defined(ELD_ARINC429_SSE2)
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                    words = _mm_srai_epi32(_mm_slli_epi32(words, left_shift), right_shift);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), words);
+                }
+#endif
+#if defined(ELD_ARINC429_NEON)
+                const int32x4_t left = vdupq_n_s32(left_shift);
+                const int32x4_t right = vdupq_n_s32(-right_shift);
+                for (; i + 4 <= n; i += 4)
+                {
+                    int32x4_t words = vreinterpretq_s32_u32(vshlq_u32(vld1q_u32(in + i), left));
+                    vst1q_s32(reinterpret_cast<int32_t *>(out + i), vshlq_s32(words, right));
+                }
+#endif
+                return i;
+            }
+
+            /**
+             * Encode unsigned field [LSB, MSB] into the leading words of the buffer.
+             * @return number of words processed.
+             */
+            template<size_t LSB, size_t MSB, typename ValueType>
+            size_t encode_simd(const ValueType *in,
+                               size_t n,
+                               traits::word_raw_type *out,
+                               std::false_type /*is_signed*/)
+            {
+                using field_t = bit_field<LSB, MSB>;
+                size_t i = 0;
+#if defined(ELD_ARINC429_AVX2)
+                const __m256i value_mask256 = _mm256_set1_epi32(int(field_t::value_mask()));
+                const __m256i mask256 = _mm256_set1_epi32(int(field_t::mask()));
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+                    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(out + i));
+                    values = _mm256_slli_epi32(_mm256_and_si256(values, value_mask256),
+                                               int(field_t::shift()));
+                    words = _mm256_or_si256(_mm256_andnot_si256(mask256, words), values);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), words);
+                }
+#endif
+#if defined(ELD_ARINC429_SSE2)
+                const __m128i value_mask128 = _mm_set1_epi32(int(field_t::value_mask()));
+                const __m128i mask128 = _mm_set1_epi32(int(field_t::mask()));
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(out + i));
+                    values = _mm_slli_epi32(_mm_and_si128(values, value_mask128),
+                                            int(field_t::shift()));
+                    words = _mm_or_si128(_mm_andnot_si128(mask128, words), values);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), words);
+                }
+#endif
+#if defined(ELD_ARINC429_NEON)
+                const uint32x4_t value_mask = vdupq_n_u32(field_t::value_mask());
+                const uint32x4_t mask = vdupq_n_u32(field_t::mask());
+                const int32x4_t shift = vdupq_n_s32(int(field_t::shift()));
+                for (; i + 4 <= n; i += 4)
+                {
+                    uint32x4_t values = vld1q_u32(reinterpret_cast<const uint32_t *>(in + i));
+                    values = vshlq_u32(vandq_u32(values, value_mask), shift);
+                    vst1q_u32(out + i, vorrq_u32(vbicq_u32(vld1q_u32(out + i), mask), values));
+                }
+#endif
+                return i;
+            }
+
+            /**
+             * Encode signed field [LSB, MSB] into the leading words of the buffer.
+             * Lower bits receive the lower bits of the value and MSB receives the sign, same as
+             * set_integral_value.
+             * @return number of words processed.
+             */
+            template<size_t LSB, size_t MSB, typename ValueType>
+            size_t encode_simd(const ValueType *in,
+                               size_t n,
+                               traits::word_raw_type *out,
+                               std::true_type /*is_signed*/)
+            {
+                using field_t = bit_field<LSB, MSB>;
+                constexpr int sign_shift = int(field_t::width() - 1);
+                size_t i = 0;
+#if defined(ELD_ARINC429_AVX2)
+                const __m256i low_mask256 = _mm256_set1_epi32(int(field_t::sign_bit() - 1));
+                const __m256i mask256 = _mm256_set1_epi32(int(field_t::mask()));
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+                    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(out + i));
+                    values = _mm256_or_si256(
+                        _mm256_and_si256(values, low_mask256),
+                        _mm256_slli_epi32(_mm256_srli_epi32(values, 31), sign_shift));
+                    values = _mm256_slli_epi32(values, int(field_t::shift()));
+                    words = _mm256_or_si256(_mm256_andnot_si256(mask256, words), values);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), words);
+                }
+#endif
+#if defined(ELD_ARINC429_SSE2)
+                const __m128i low_mask128 = _mm_set1_epi32(int(field_t::sign_bit() - 1));
+                const __m128i mask128 = _mm_set1_epi32(int(field_t::mask()));
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(out + i));
+                    values = _mm_or_si128(_mm_and_si128(values, low_mask128),
+                                          _mm_slli_epi32(_mm_srli_epi32(values, 31), sign_shift));
+                    values = _mm_slli_epi32(values, int(field_t::shift()));
+                    words = _mm_or_si128(_mm_andnot_si128(mask128, words), values);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), words);
+                }
+#endif
+#if defined(ELD_ARINC429_NEON)
+                const uint32x4_t low_mask = vdupq_n_u32(field_t::sign_bit() - 1);
+                const uint32x4_t mask = vdupq_n_u32(field_t::mask());
+                const int32x4_t shift = vdupq_n_s32(int(field_t::shift()));
+                for (; i + 4 <= n; i += 4)
+                {
+                    uint32x4_t values = vld1q_u32(reinterpret_cast<const uint32_t *>(in + i));
+                    values = vorrq_u32(vandq_u32(values, low_mask),
+                                       vshlq_u32(vshrq_n_u32(values, 31), vdupq_n_s32(sign_shift)));
+                    values = vshlq_u32(values, shift);
+                    vst1q_u32(out + i, vorrq_u32(vbicq_u32(vld1q_u32(out + i), mask), values));
+                }
+#endif
+                return i;
+            }
+
+            template<typename DataDescriptor, typename ValueType>
+            void decode_batch(const traits::word_raw_type *in,
+                              size_t n,
+                              ValueType *out,
+                              std::true_type /*use_simd_kernel*/)
+            {
+                using traits_t = traits::data_descriptor_traits<DataDescriptor>;
+
+                const size_t processed = decode_simd<traits_t::lsb(), traits_t::msb()>(
+                    in,
+                    n,
+                    out,
+                    std::is_signed<ValueType>());
+                decode_batch<DataDescriptor>(in + processed,
+                                             n - processed,
+                                             out + processed,
+                                             std::false_type{});
+            }
+
+            template<typename DataDescriptor, typename ValueType>
+            void encode_batch(const ValueType *in,
+                              size_t n,
+                              traits::word_raw_type *out,
+                              std::true_type /*use_simd_kernel*/)
+            {
+                using traits_t = traits::data_descriptor_traits<DataDescriptor>;
+
+                const size_t processed = encode_simd<traits_t::lsb(), traits_t::msb()>(
+                    in,
+                    n,
+                    out,
+                    std::is_signed<ValueType>());
+                encode_batch<DataDescriptor>(in + processed,
+                                             n - processed,
+                                             out + processed,
+                                             std::false_type{});
+            }
+
+            /**
+             * Find words with invalid parity among the leading words of the buffer. Lane
+             * parity is computed by folding the bits with xor.
+             * @return number of words processed.
+             */
+            inline size_t parity_errors_simd(const traits::word_raw_type *in,
+                                             size_t n,
+                                             uint64_t *badWords,
+                                             size_t &badCount)
+            {
+                size_t i = 0;
+#if defined(ELD_ARINC429_AVX2)
+                for (; i + 8 <= n; i += 8)
+                {
+                    __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+                    words = _mm256_xor_si256(words, _mm256_srli_epi32(words, 16));
+                    words = _mm256_xor_si256(words, _mm256_srli_epi32(words, 8));
+                    words = _mm256_xor_si256(words, _mm256_srli_epi32(words, 4));
+                    words = _mm256_xor_si256(words, _mm256_srli_epi32(words, 2));
+                    words = _mm256_xor_si256(words, _mm256_srli_epi32(words, 1));
+                    const auto bad = traits::word_raw_type(_mm256_movemask_ps(
+                                         _mm256_castsi256_ps(_mm256_slli_epi32(words, 31)))) ^
+                                     0xff;
+                    badWords[i / 64] |= uint64_t(bad) << (i % 64);
+                    badCount += popcount(bad);
+                }
+#endif
+#if defined(ELD_ARINC429_SSE2)
+                for (; i + 4 <= n; i += 4)
+                {
+                    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                    words = _mm_xor_si128(words, _mm_srli_epi32(words, 16));
+                    words = _mm_xor_si128(words, _mm_srli_epi32(words, 8));
+                    words = _mm_xor_si128(words, _mm_srli_epi32(words, 4));
+                    words = _mm_xor_si128(words, _mm_srli_epi32(words, 2));
+                    words = _mm_xor_si128(words, _mm_srli_epi32(words, 1));
+                    const auto bad = traits::word_raw_type(_mm_movemask_ps(
+                                         _mm_castsi128_ps(_mm_slli_epi32(words, 31)))) ^
+                                     0xf;
+                    badWords[i / 64] |= uint64_t(bad) << (i % 64);
+                    badCount += popcount(bad);
+                }
+#endif
+#if defined(ELD_ARINC429_NEON)
+                const uint32x4_t one = vdupq_n_u32(1);
+                for (; i + 4 <= n; i += 4)
+                {
+                    // count bits per byte and sum bytes of each lane
+                    const uint8x16_t bytes = vcntq_u8(vreinterpretq_u8_u32(vld1q_u32(in + i)));
+                    const uint32x4_t counts = vpaddlq_u16(vpaddlq_u8(bytes));
+                    const uint32x4_t bad = veorq_u32(vandq_u32(counts, one), one);
+                    const auto laneBits = traits::word_raw_type(
+                        vgetq_lane_u32(bad, 0) | vgetq_lane_u32(bad, 1) << 1 |
+                        vgetq_lane_u32(bad, 2) << 2 | vgetq_lane_u32(bad, 3) << 3);
+                    badWords[i / 64] |= uint64_t(laneBits) << (i % 64);
+                    badCount += popcount(laneBits);
+                }
+#endif
+                return i;
+            }
+
+            /**
+             * Match SSM of the leading words of the buffer with the accepted codes. SSM is
+             * compared with each code, codes that are not accepted are replaced with a value
+             * that never matches.
+             * @param visitor callable with signature
+             * void(size_t first, traits::word_raw_type accepted, size_t lanes), called for each
+             * vector of lanes words starting at first with bit lane of accepted set for each
+             * accepted word.
+             * @return number of words processed.
+             */
+            template<typename VisitorT>
+            size_t match_ssm_simd(const traits::word_raw_type *in,
+                                  size_t n,
+                                  uint8_t acceptedSsm,
+                                  VisitorT &&visitor)
+            {
+                const auto code = [acceptedSsm](int ssm) {
+                    return (acceptedSsm >> ssm) & 1 ? ssm : -1;
+                };
+
+                size_t i = 0;
+#if defined(ELD_ARINC429_AVX2)
+                {
+                    const __m256i valueMask = _mm256_set1_epi32(int(ssm_field_t::value_mask()));
+                    const __m256i code0 = _mm256_set1_epi32(code(0));
+                    const __m256i code1 = _mm256_set1_epi32(code(1));
+                    const __m256i code2 = _mm256_set1_epi32(code(2));
+                    const __m256i code3 = _mm256_set1_epi32(code(3));
+                    for (; i + 8 <= n; i += 8)
+                    {
+                        const __m256i ssm = _mm256_and_si256(
+                            _mm256_srli_epi32(
+                                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i)),
+                                int(ssm_field_t::shift())),
+                            valueMask);
+                        const __m256i accepted =
+                            _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi32(ssm, code0),
+                                                            _mm256_cmpeq_epi32(ssm, code1)),
+                                            _mm256_or_si256(_mm256_cmpeq_epi32(ssm, code2),
+                                                            _mm256_cmpeq_epi32(ssm, code3)));
+                        visitor(i,
+                                traits::word_raw_type(
+                                    _mm256_movemask_ps(_mm256_castsi256_ps(accepted))),
+                                8);
+                    }
+                }
+#endif
+#if defined(ELD_ARINC429_SSE2)
+                {
+                    const __m128i valueMask = _mm_set1_epi32(int(ssm_field_t::value_mask()));
+                    const __m128i code0 = _mm_set1_epi32(code(0));
+                    const __m128i code1 = _mm_set1_epi32(code(1));
+                    const __m128i code2 = _mm_set1_epi32(code(2));
+                    const __m128i code3 = _mm_set1_epi32(code(3));
+                    for (; i + 4 <= n; i += 4)
+                    {
+                        const __m128i ssm = _mm_and_si128(
+                            _mm_srli_epi32(
+                                _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i)),
+                                int(ssm_field_t::shift())),
+                            valueMask);
+                        const __m128i accepted =
+                            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(ssm, code0),
+                                                      _mm_cmpeq_epi32(ssm, code1)),
+                                         _mm_or_si128(_mm_cmpeq_epi32(ssm, code2),
+                                                      _mm_cmpeq_epi32(ssm, code3)));
+                        visitor(i,
+                                traits::word_raw_type(
+                                    _mm_movemask_ps(_mm_castsi128_ps(accepted))),
+                                4);
+                    }
+                }
+#endif
+#if defined(ELD_ARINC429_NEON)
+                {
+                    const uint32x4_t valueMask = vdupq_n_u32(ssm_field_t::value_mask());
+                    const uint32x4_t code0 = vdupq_n_u32(uint32_t(code(0)));
+                    const uint32x4_t code1 = vdupq_n_u32(uint32_t(code(1)));
+                    const uint32x4_t code2 = vdupq_n_u32(uint32_t(code(2)));
+                    const uint32x4_t code3 = vdupq_n_u32(uint32_t(code(3)));
+                    const uint32x4_t one = vdupq_n_u32(1);
+                    for (; i + 4 <= n; i += 4)
+                    {
+                        const uint32x4_t ssm =
+                            vandq_u32(vshrq_n_u32(vld1q_u32(in + i), ssm_field_t::shift()),
+                                      valueMask);
+                        const uint32x4_t accepted = vandq_u32(
+                            vorrq_u32(vorrq_u32(vceqq_u32(ssm, code0), vceqq_u32(ssm, code1)),
+                                      vorrq_u32(vceqq_u32(ssm, code2), vceqq_u32(ssm, code3))),
+                            one);
+                        visitor(i,
+                                traits::word_raw_type(vgetq_lane_u32(accepted, 0) |
+                                                      vgetq_lane_u32(accepted, 1) << 1 |
+                                                      vgetq_lane_u32(accepted, 2) << 2 |
+                                                      vgetq_lane_u32(accepted, 3) << 3),
+                                4);
+                    }
+                }
+#endif
+                return i;
+            }
+#endif
+
+            inline bool is_ssm_accepted(traits::word_raw_type wordRaw, uint8_t acceptedSsm)
+            {
+                return (acceptedSsm >> ssm_field_t::extract(wordRaw)) & 1;
+            }
+
+            template<typename /*TupleDescriptors*/>
+            struct soa_decoder;
+
+            template<typename... DataDescriptors>
+            struct soa_decoder<std::tuple<DataDescriptors...>>
+            {
+                static void decode(const traits::word_raw_type *in,
+                                   size_t n,
+                                   traits::value_type_t<DataDescriptors> *... columns)
+                {
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        const traits::word_raw_type wordRaw = in[i];
+                        const int expand[]{
+                            (arinc429::get_value<DataDescriptors>(columns[i], wordRaw), 0)...
+                        };
+                        (void)expand;
+                    }
+                }
+            };
+        }
+
+        /**
+         * Decode data described by DataDescriptor from each of n raw words.
+         * @param in buffer of n raw words.
+         * @param n number of words.
+         * @param out buffer of n values.
+         */
+        template<typename DataDescriptor,
+                 typename ValueType =
+                     typename traits::data_descriptor_traits<DataDescriptor>::value_type>
+        void decode_batch(const traits::word_raw_type *in, size_t n, ValueType *out)
+        {
+            detail::decode_batch<DataDescriptor>(
+                in,
+                n,
+                out,
+                detail::use_simd_decode_t<DataDescriptor, ValueType>());
+        }
+
+        /**
+         * Encode each of n values into the data described by DataDescriptor of the matching
+         * raw word. Bits outside of the descriptor are preserved.
+         * @param in buffer of n values.
+         * @param n number of words.
+         * @param out buffer of n raw words.
+         */
+        template<typename DataDescriptor,
+                 typename ValueType =
+                     typename traits::data_descriptor_traits<DataDescriptor>::value_type>
+        void encode_batch(const ValueType *in, size_t n, traits::word_raw_type *out)
+        {
+            detail::encode_batch<DataDescriptor>(
+                in,
+                n,
+                out,
+                detail::use_simd_encode_t<DataDescriptor, ValueType>());
+        }
+
+        /**
+         * Copy n words into a buffer of raw words, e.g. a capture or DMA buffer. Words are
+         * trivially copyable and have the size of a raw word, so this is a single memcpy.
+         * @tparam WordT word_generic type.
+         */
+        template<typename WordT>
+        void to_raw_batch(const WordT *in, size_t n, traits::word_raw_type *out)
+        {
+            static_assert(sizeof(WordT) == sizeof(traits::word_raw_type) &&
+                              std::is_trivially_copyable<WordT>::value,
+                          "Words must be trivially copyable raw words!");
+            if (n != 0)
+            {
+                std::memcpy(out, in, n * sizeof(traits::word_raw_type));
+            }
+        }
+
+        /**
+         * Copy n raw words into a buffer of words with a single memcpy.
+         * @tparam WordT word_generic type.
+         */
+        template<typename WordT>
+        void from_raw_batch(const traits::word_raw_type *in, size_t n, WordT *out)
+        {
+            static_assert(sizeof(WordT) == sizeof(traits::word_raw_type) &&
+                              std::is_trivially_copyable<WordT>::value,
+                          "Words must be trivially copyable raw words!");
+            if (n != 0)
+            {
+                std::memcpy(static_cast<void *>(out), in, n * sizeof(traits::word_raw_type));
+            }
+        }
+
+        /**
+         * Decode all data of WordT from each of n raw words in a single pass. Values are written
+         * in structure-of-arrays layout: one column per data descriptor, in the order of
+         * WordT::tuple_descriptors.
+         * @tparam WordT word_generic type.
+         * @param in buffer of n raw words.
+         * @param n number of words.
+         * @param columns buffers of n values for each of the data descriptors.
+         */
+        template<typename WordT, typename... ValueTypes>
+        void decode_soa(const traits::word_raw_type *in, size_t n, ValueTypes *... columns)
+        {
+            using tuple_descriptors = typename traits::word_traits<WordT>::tuple_descriptors;
+            static_assert(sizeof...(ValueTypes) == std::tuple_size<tuple_descriptors>(),
+                          "Number of columns does not match number of data descriptors!");
+
+            detail::soa_decoder<tuple_descriptors>::decode(in, n, columns...);
+        }
+
+        /**
+         * Validate ARINC 429 odd parity of each of n raw words.
+         * @param in buffer of n raw words.
+         * @param n number of words.
+         * @param badWords bitmask of (n + 63) / 64 elements. Bit i % 64 of element i / 64 is
+         * set if word i has invalid parity.
+         * @return number of words with invalid parity.
+         */
+        inline size_t validate_parity_batch(const traits::word_raw_type *in,
+                                            size_t n,
+                                            uint64_t *badWords)
+        {
+            for (size_t i = 0; i < (n + 63) / 64; ++i)
+            {
+                badWords[i] = 0;
+            }
+
+            size_t badCount = 0;
+            size_t i = 0;
+#if defined(ELD_ARINC429_SIMD)
+            i = detail::parity_errors_simd(in, n, badWords, badCount);
+#endif
+            for (; i < n; ++i)
+            {
+                const bool bad = !validate_parity(in[i]);
+                badWords[i / 64] |= uint64_t(bad) << (i % 64);
+                badCount += bad;
+            }
+            return badCount;
+        }
+
+        /**
+         * Find words with accepted SSM (bits 30-31) among n raw words, e.g. bnr_valid_ssm to
+         * discard failure warning and no computed data.
+         * @param in buffer of n raw words, n must not exceed the range of uint32_t.
+         * @param acceptedSsm set of accepted codes, see ssm_mask.
+         * @param indices buffer of n indices, receives indices of the accepted words in order.
+         * @return number of accepted words.
+         */
+        inline size_t filter_ssm_batch(const traits::word_raw_type *in,
+                                       size_t n,
+                                       uint8_t acceptedSsm,
+                                       uint32_t *indices)
+        {
+            assert(n <= std::numeric_limits<uint32_t>::max() && "Too many words for indices!");
+
+            size_t count = 0;
+            size_t i = 0;
+#if defined(ELD_ARINC429_SIMD)
+            i = detail::match_ssm_simd(
+                in,
+                n,
+                acceptedSsm,
+                [&count, indices](size_t first, traits::word_raw_type accepted, size_t lanes) {
+                    // the index is overwritten by the next lane unless the word is accepted
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        indices[count] = uint32_t(first + lane);
+                        count += (accepted >> lane) & 1;
+                    }
+                });
+#endif
+            for (; i < n; ++i)
+            {
+                indices[count] = uint32_t(i);
+                count += detail::is_ssm_accepted(in[i], acceptedSsm);
+            }
+            return count;
+        }
+
+        /**
+         * Split n raw words by SDI (bits 9-10), keeping the words with accepted SSM.
+         * @param out buffers for each SDI, out[sdi] receives the accepted words with the SDI in
+         * order and must fit all of them.
+         * @param counts numbers of words written to each of the buffers.
+         * @param acceptedSsm set of accepted codes, see ssm_mask.
+         * @return number of accepted words.
+         */
+        inline size_t partition_sdi_batch(const traits::word_raw_type *in,
+                                          size_t n,
+                                          traits::word_raw_type *const (&out)[detail::sdi_count],
+                                          size_t (&counts)[detail::sdi_count],
+                                          uint8_t acceptedSsm = any_ssm)
+        {
+            for (auto &count : counts)
+            {
+                count = 0;
+            }
+
+            const auto store = [&out, &counts](traits::word_raw_type wordRaw) {
+                size_t &count = counts[detail::sdi_field_t::extract(wordRaw)];
+                out[detail::sdi_field_t::extract(wordRaw)][count++] = wordRaw;
+            };
+
+            size_t i = 0;
+#if defined(ELD_ARINC429_SIMD)
+            i = detail::match_ssm_simd(
+                in,
+                n,
+                acceptedSsm,
+                [in, &store](size_t first, traits::word_raw_type accepted, size_t lanes) {
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                    {
+                        if ((accepted >> lane) & 1)
+                        {
+                            store(in[first + lane]);
+                        }
+                    }
+                });
+#endif
+            for (; i < n; ++i)
+            {
+                if (detail::is_ssm_accepted(in[i], acceptedSsm))
+                {
+                    store(in[i]);
+                }
+            }
+            return counts[0] + counts[1] + counts[2] + counts[3];
+        }
+    }
+}
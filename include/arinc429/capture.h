@@ -0,0 +1,471 @@
+﻿#pragma once
+
+#include "arinc429/arinc429.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define ELD_ARINC429_HAS_MMAP
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+/**
+ * Capture file format for bus recordings.
+ *
+ * Layout (little-endian):
+ * - capture_header, 64 bytes;
+ * - records_count capture_record entries, 16 bytes each;
+ * - block index: a capture_block_labels entry for each block of block_size records.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        constexpr uint16_t capture_version = 1;
+
+        constexpr uint32_t capture_default_block_size = 4096;
+
+        /**
+         * Received raw word.
+         */
+        struct capture_record
+        {
+            uint64_t timestamp;
+            traits::word_raw_type word;
+            uint16_t channel;
+            uint16_t flags;
+        };
+
+        static_assert(sizeof(capture_record) == 16, "Unexpected capture record size!");
+
+        struct capture_header
+        {
+            char magic[8];
+            uint16_t version;
+            uint16_t header_size;
+            uint32_t record_size;
+            uint64_t records_count;
+            uint64_t index_offset;
+            uint32_t block_size;
+            uint32_t reserved;
+            uint8_t padding[24];
+        };
+
+        static_assert(sizeof(capture_header) == 64, "Unexpected capture header size!");
+
+        /**
+         * Labels of the records of a block: bit label % 64 of labels[label / 64].
+         */
+        struct capture_block_labels
+        {
+            uint64_t labels[4];
+
+            bool contains(uint8_t label) const { return (labels[label / 64] >> label % 64) & 1u; }
+
+            void insert(uint8_t label) { labels[label / 64] |= uint64_t(1) << label % 64; }
+        };
+
+        namespace detail
+        {
+            constexpr char capture_magic[8]{ 'A', '4', '2', '9', 'C', 'A', 'P', '\0' };
+
+            inline bool is_little_endian()
+            {
+                const uint16_t value = 1;
+                uint8_t firstByte = 0;
+                std::memcpy(&firstByte, &value, 1);
+                return firstByte == 1;
+            }
+
+            /**
+             * Read-only contents of a file, memory-mapped where available and read into memory
+             * otherwise.
+             */
+            class mapped_file
+            {
+            public:
+                mapped_file() = default;
+
+                mapped_file(const mapped_file &) = delete;
+                mapped_file &operator=(const mapped_file &) = delete;
+
+                ~mapped_file() { close(); }
+
+                bool is_open() const { return data_ != nullptr; }
+
+                const uint8_t *data() const { return data_; }
+
+                size_t size() const { return size_; }
+
+#if defined(ELD_ARINC429_HAS_MMAP)
+                bool open(const char *path)
+                {
+                    const int fd = ::open(path, O_RDONLY);
+                    if (fd < 0)
+                    {
+                        return false;
+                    }
+
+                    struct stat fileStat
+                    {
+                    };
+                    void *mapped = MAP_FAILED;
+                    if (::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+                    {
+                        mapped = ::mmap(nullptr,
+                                        size_t(fileStat.st_size),
+                                        PROT_READ,
+                                        MAP_PRIVATE,
+                                        fd,
+                                        0);
+                    }
+                    ::close(fd);
+                    if (mapped == MAP_FAILED)
+                    {
+                        return false;
+                    }
+
+                    ::madvise(mapped, size_t(fileStat.st_size), MADV_SEQUENTIAL);
+                    data_ = static_cast<const uint8_t *>(mapped);
+                    size_ = size_t(fileStat.st_size);
+                    return true;
+                }
+
+                void close()
+                {
+                    if (data_)
+                    {
+                        ::munmap(const_cast<uint8_t *>(data_), size_);
+                    }
+                    data_ = nullptr;
+                    size_ = 0;
+                }
+#else
+                bool open(const char *path)
+                {
+                    std::FILE *file = std::fopen(path, "rb");
+                    if (!file)
+                    {
+                        return false;
+                    }
+
+                    bool read = std::fseek(file, 0, SEEK_END) == 0;
+                    const long fileSize = read ? std::ftell(file) : -1L;
+                    read = fileSize > 0 && std::fseek(file, 0, SEEK_SET) == 0;
+                    if (read)
+                    {
+                        // uint64_t elements keep records aligned
+                        buffer_.resize((size_t(fileSize) + sizeof(uint64_t) - 1) /
+                                       sizeof(uint64_t));
+                        read = std::fread(buffer_.data(), 1, size_t(fileSize), file) ==
+                               size_t(fileSize);
+                    }
+                    std::fclose(file);
+                    if (!read)
+                    {
+                        buffer_.clear();
+                        return false;
+                    }
+
+                    data_ = reinterpret_cast<const uint8_t *>(buffer_.data());
+                    size_ = size_t(fileSize);
+                    return true;
+                }
+
+                void close()
+                {
+                    buffer_.clear();
+                    buffer_.shrink_to_fit();
+                    data_ = nullptr;
+                    size_ = 0;
+                }
+#endif
+
+            private:
+#if !defined(ELD_ARINC429_HAS_MMAP)
+                std::vector<uint64_t> buffer_;
+#endif
+                const uint8_t *data_ = nullptr;
+                size_t size_ = 0;
+            };
+
+            inline bool is_valid_capture(const uint8_t *data, size_t size)
+            {
+                if (size < sizeof(capture_header))
+                {
+                    return false;
+                }
+
+                capture_header header{};
+                std::memcpy(&header, data, sizeof(header));
+                if (std::memcmp(header.magic, capture_magic, sizeof(capture_magic)) != 0 ||
+                    header.version != capture_version ||
+                    header.header_size != sizeof(capture_header) ||
+                    header.record_size != sizeof(capture_record) || header.block_size == 0)
+                {
+                    return false;
+                }
+
+                // divisions instead of products, a crafted header must not overflow the bounds
+                if (header.records_count >
+                    (size - sizeof(capture_header)) / sizeof(capture_record))
+                {
+                    return false;
+                }
+
+                const uint64_t blocksCount = header.records_count / header.block_size +
+                                             (header.records_count % header.block_size != 0);
+                return header.index_offset ==
+                           sizeof(capture_header) +
+                               header.records_count * sizeof(capture_record) &&
+                       (size - header.index_offset) / sizeof(capture_block_labels) >= blocksCount;
+            }
+        }
+
+        /**
+         * Contiguous records of a capture.
+         */
+        class capture_view
+        {
+        public:
+            constexpr capture_view() = default;
+
+            constexpr capture_view(const capture_record *records, size_t count)
+              : records_(records),
+                count_(count)
+            {
+            }
+
+            const capture_record *begin() const { return records_; }
+
+            const capture_record *end() const { return records_ + count_; }
+
+            const capture_record &operator[](size_t index) const { return records_[index]; }
+
+            size_t size() const { return count_; }
+
+            bool empty() const { return count_ == 0; }
+
+        private:
+            const capture_record *records_ = nullptr;
+            size_t count_ = 0;
+        };
+
+        /**
+         * Writes records to a capture file. The header and the block index are written on close.
+         */
+        class capture_writer
+        {
+        public:
+            explicit capture_writer(uint32_t blockSize = capture_default_block_size)
+              : block_size_(blockSize ? blockSize : capture_default_block_size)
+            {
+            }
+
+            capture_writer(const capture_writer &) = delete;
+            capture_writer &operator=(const capture_writer &) = delete;
+
+            ~capture_writer() { close(); }
+
+            /**
+             * Create or truncate a capture file.
+             * @return false if the file can not be opened.
+             */
+            bool open(const char *path)
+            {
+                close();
+                file_ = std::fopen(path, "wb");
+                if (!file_)
+                {
+                    return false;
+                }
+
+                records_count_ = 0;
+                blocks_.clear();
+                const capture_header header{};
+                return write_bytes(&header, sizeof(header));
+            }
+
+            bool is_open() const { return file_ != nullptr; }
+
+            bool write(const capture_record &record) { return write(&record, 1); }
+
+            /**
+             * Append n records.
+             * @return false on error.
+             */
+            bool write(const capture_record *records, size_t n)
+            {
+                if (!file_)
+                {
+                    return false;
+                }
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (records_count_ % block_size_ == 0)
+                    {
+                        blocks_.push_back(capture_block_labels{});
+                    }
+                    const auto label = detail::bit_field<1, 8>::extract(records[i].word);
+                    blocks_.back().insert(uint8_t(label));
+                    ++records_count_;
+                }
+                return write_bytes(records, n * sizeof(capture_record));
+            }
+
+            /**
+             * Write the block index and the header and close the file.
+             * @return false on error.
+             */
+            bool close()
+            {
+                if (!file_)
+                {
+                    return true;
+                }
+
+                capture_header header{};
+                std::memcpy(header.magic, detail::capture_magic, sizeof(header.magic));
+                header.version = capture_version;
+                header.header_size = sizeof(capture_header);
+                header.record_size = sizeof(capture_record);
+                header.records_count = records_count_;
+                header.index_offset =
+                    sizeof(capture_header) + records_count_ * sizeof(capture_record);
+                header.block_size = block_size_;
+
+                bool written =
+                    write_bytes(blocks_.data(), blocks_.size() * sizeof(capture_block_labels));
+                written = written && std::fseek(file_, 0, SEEK_SET) == 0 &&
+                          write_bytes(&header, sizeof(header));
+                written = std::fclose(file_) == 0 && written;
+                file_ = nullptr;
+                return written;
+            }
+
+        private:
+            bool write_bytes(const void *data, size_t size)
+            {
+                return size == 0 || std::fwrite(data, 1, size, file_) == size;
+            }
+
+            uint32_t block_size_;
+            std::FILE *file_ = nullptr;
+            uint64_t records_count_ = 0;
+            std::vector<capture_block_labels> blocks_;
+        };
+
+        /**
+         * Read-only access to a capture file. The file is memory-mapped where available and
+         * read into memory otherwise; records are accessed in place.
+         */
+        class capture_reader
+        {
+        public:
+            capture_reader() = default;
+
+            capture_reader(const capture_reader &) = delete;
+            capture_reader &operator=(const capture_reader &) = delete;
+
+            ~capture_reader() { close(); }
+
+            /**
+             * Open and validate a capture file.
+             * @return false if the file can not be read or is not a valid capture.
+             */
+            bool open(const char *path)
+            {
+                close();
+                if (!detail::is_little_endian() || !file_.open(path))
+                {
+                    return false;
+                }
+
+                if (!detail::is_valid_capture(file_.data(), file_.size()))
+                {
+                    close();
+                    return false;
+                }
+                std::memcpy(&header_, file_.data(), sizeof(header_));
+                return true;
+            }
+
+            void close()
+            {
+                file_.close();
+                header_ = capture_header{};
+            }
+
+            bool is_open() const { return file_.is_open(); }
+
+            const capture_header &header() const { return header_; }
+
+            /**
+             * All records.
+             */
+            capture_view records() const
+            {
+                return capture_view(records_data(), size_t(header_.records_count));
+            }
+
+            size_t blocks_count() const
+            {
+                return header_.block_size
+                           ? size_t(header_.records_count / header_.block_size +
+                                    (header_.records_count % header_.block_size != 0))
+                           : 0;
+            }
+
+            /**
+             * Records of a block.
+             */
+            capture_view block(size_t index) const
+            {
+                const uint64_t first = uint64_t(index) * header_.block_size;
+                const uint64_t last = std::min<uint64_t>(first + header_.block_size,
+                                                         header_.records_count);
+                return capture_view(records_data() + first, size_t(last - first));
+            }
+
+            const capture_block_labels &block_labels(size_t index) const
+            {
+                return reinterpret_cast<const capture_block_labels *>(file_.data() +
+                                                                      header_.index_offset)[index];
+            }
+
+            /**
+             * Call visitor with each block that has records with the label.
+             * @param visitor callable with signature void(capture_view).
+             */
+            template<typename VisitorT>
+            void for_each_block(uint8_t label, VisitorT &&visitor) const
+            {
+                for (size_t i = 0; i < blocks_count(); ++i)
+                {
+                    if (block_labels(i).contains(label))
+                    {
+                        visitor(block(i));
+                    }
+                }
+            }
+
+        private:
+            const capture_record *records_data() const
+            {
+                return reinterpret_cast<const capture_record *>(file_.data() +
+                                                                sizeof(capture_header));
+            }
+
+            detail::mapped_file file_;
+            capture_header header_{};
+        };
+    }
+}
@@ -0,0 +1,623 @@
+﻿#pragma once
+
+#include "arinc429/capture.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+/**
+ * Compressed capture file format for archival.
+ *
+ * Layout (little-endian):
+ * - capture_header with the compressed magic, 64 bytes;
+ * - compressed blocks of block_size records, each of them is decoded on its own;
+ * - padding to 8 bytes;
+ * - block index: a compressed_capture_block entry for each block.
+ *
+ * A record is a control byte, the label (bits 1-8 of the word) and the fields present according
+ * to the control byte:
+ * - bit 6: channel differs from the previous record, 2 bytes;
+ * - bit 7: flags differ from the previous record, 2 bytes;
+ * - bits 0-3: number of bytes of the zigzag-encoded timestamp delta, 0-8;
+ * - bits 4-5: number of bytes of bits 9-32 of the word XORed with the previous word with the
+ *   label, 0-3.
+ * The previous timestamp, channel, flags and words of all labels are 0 at the start of a block.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        constexpr uint16_t compressed_capture_version = 1;
+
+        /**
+         * Index entry of a compressed block.
+         */
+        struct compressed_capture_block
+        {
+            /**
+             * Offset of the block from the beginning of the file.
+             */
+            uint64_t offset;
+            uint32_t size;
+            uint32_t records_count;
+            uint64_t first_timestamp;
+            uint64_t last_timestamp;
+            capture_block_labels labels;
+        };
+
+        static_assert(sizeof(compressed_capture_block) == 64,
+                      "Unexpected compressed block index entry size!");
+
+        namespace detail
+        {
+            constexpr char compressed_capture_magic[8]{ 'A', '4', '2', '9', 'C', 'P', 'Z', '\0' };
+
+            constexpr size_t capture_labels_count = size_t(1) << bit_field<1, 8>::width();
+
+            /**
+             * Maximum size of an encoded record.
+             */
+            constexpr size_t max_compressed_record_size = 1 + 1 + 2 + 2 + 8 + 3;
+
+            /**
+             * Minimum size of an encoded record: the control byte and the label.
+             */
+            constexpr size_t min_compressed_record_size = 1 + 1;
+
+            inline uint64_t zigzag_encode(uint64_t delta)
+            {
+                return (delta << 1) ^ (0 - (delta >> 63));
+            }
+
+            inline uint64_t zigzag_decode(uint64_t value)
+            {
+                return (value >> 1) ^ (0 - (value & 1));
+            }
+
+            inline uint8_t bytes_count(uint64_t value)
+            {
+                uint8_t count = 0;
+                for (; value != 0; value >>= 8)
+                {
+                    ++count;
+                }
+                return count;
+            }
+
+            /**
+             * Load n of the available bytes up to end as a little-endian value.
+             */
+            inline uint64_t load_bytes(const uint8_t *in, size_t n, const uint8_t *end)
+            {
+                if (end - in >= 8)
+                {
+                    uint64_t value = 0;
+                    std::memcpy(&value, in, sizeof(value));
+                    return n == 8 ? value : value & ((uint64_t(1) << 8 * n) - 1);
+                }
+
+                uint64_t value = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    value |= uint64_t(in[i]) << 8 * i;
+                }
+                return value;
+            }
+
+            inline void store_bytes(uint64_t value, size_t n, std::vector<uint8_t> &out)
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    out.push_back(uint8_t(value >> 8 * i));
+                }
+            }
+
+            /**
+             * Encodes records of a block.
+             */
+            class capture_block_encoder
+            {
+            public:
+                void reset()
+                {
+                    bytes_.clear();
+                    records_count_ = 0;
+                    timestamp_ = 0;
+                    channel_ = 0;
+                    flags_ = 0;
+                    std::fill(std::begin(words_), std::end(words_), 0);
+                }
+
+                void encode(const capture_record &record)
+                {
+                    const auto label = uint8_t(bit_field<1, 8>::extract(record.word));
+                    const uint64_t delta = zigzag_encode(record.timestamp - timestamp_);
+                    const traits::word_raw_type changes = (record.word ^ words_[label]) >> 8;
+                    const uint8_t deltaBytes = bytes_count(delta);
+                    const uint8_t changesBytes = bytes_count(changes);
+
+                    bytes_.push_back(uint8_t(deltaBytes | changesBytes << 4 |
+                                             (record.channel != channel_ ? 0x40 : 0) |
+                                             (record.flags != flags_ ? 0x80 : 0)));
+                    bytes_.push_back(label);
+                    if (record.channel != channel_)
+                    {
+                        store_bytes(record.channel, 2, bytes_);
+                    }
+                    if (record.flags != flags_)
+                    {
+                        store_bytes(record.flags, 2, bytes_);
+                    }
+                    store_bytes(delta, deltaBytes, bytes_);
+                    store_bytes(changes, changesBytes, bytes_);
+
+                    timestamp_ = record.timestamp;
+                    channel_ = record.channel;
+                    flags_ = record.flags;
+                    words_[label] = record.word;
+                    ++records_count_;
+                }
+
+                const std::vector<uint8_t> &bytes() const { return bytes_; }
+
+                size_t records_count() const { return records_count_; }
+
+            private:
+                std::vector<uint8_t> bytes_;
+                size_t records_count_ = 0;
+                uint64_t timestamp_ = 0;
+                uint16_t channel_ = 0;
+                uint16_t flags_ = 0;
+                traits::word_raw_type words_[capture_labels_count]{};
+            };
+
+            /**
+             * Decode count records of a block.
+             * @return false if the block is truncated or invalid.
+             */
+            inline bool decode_capture_block(const uint8_t *in,
+                                             size_t size,
+                                             size_t count,
+                                             capture_record *out)
+            {
+                const uint8_t *const end = in + size;
+                traits::word_raw_type words[capture_labels_count]{};
+                uint64_t timestamp = 0;
+                uint16_t channel = 0;
+                uint16_t flags = 0;
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (end - in < 2)
+                    {
+                        return false;
+                    }
+                    const uint8_t control = in[0];
+                    const uint8_t label = in[1];
+                    const size_t deltaBytes = control & 0x0f;
+                    const size_t changesBytes = (control >> 4) & 0x03;
+                    const size_t channelBytes = (control & 0x40) ? 2 : 0;
+                    const size_t flagsBytes = (control & 0x80) ? 2 : 0;
+                    in += 2;
+
+                    if (deltaBytes > 8 ||
+                        size_t(end - in) < channelBytes + flagsBytes + deltaBytes + changesBytes)
+                    {
+                        return false;
+                    }
+
+                    if (channelBytes)
+                    {
+                        channel = uint16_t(in[0] | in[1] << 8);
+                        in += 2;
+                    }
+                    if (flagsBytes)
+                    {
+                        flags = uint16_t(in[0] | in[1] << 8);
+                        in += 2;
+                    }
+                    timestamp += zigzag_decode(load_bytes(in, deltaBytes, end));
+                    in += deltaBytes;
+                    words[label] ^= traits::word_raw_type(load_bytes(in, changesBytes, end)) << 8;
+                    words[label] |= label;
+                    in += changesBytes;
+
+                    out[i] = capture_record{ timestamp, words[label], channel, flags };
+                }
+                return in == end;
+            }
+
+            inline bool is_valid_compressed_capture(const uint8_t *data, size_t size)
+            {
+                if (size < sizeof(capture_header))
+                {
+                    return false;
+                }
+
+                capture_header header{};
+                std::memcpy(&header, data, sizeof(header));
+                if (std::memcmp(header.magic,
+                                compressed_capture_magic,
+                                sizeof(compressed_capture_magic)) != 0 ||
+                    header.version != compressed_capture_version ||
+                    header.header_size != sizeof(capture_header) ||
+                    header.record_size != sizeof(capture_record) || header.block_size == 0 ||
+                    header.index_offset < sizeof(capture_header) || header.index_offset > size ||
+                    header.index_offset % alignof(compressed_capture_block) != 0)
+                {
+                    return false;
+                }
+
+                const uint64_t blocksCount = header.records_count / header.block_size +
+                                             (header.records_count % header.block_size != 0);
+                if ((size - header.index_offset) / sizeof(compressed_capture_block) < blocksCount)
+                {
+                    return false;
+                }
+
+                // blocks do not overlap and hold at least the minimum size of their records,
+                // so the records of a file take no more memory than a multiple of its size
+                uint64_t blocksEnd = sizeof(capture_header);
+                for (uint64_t i = 0; i < blocksCount; ++i)
+                {
+                    compressed_capture_block block{};
+                    std::memcpy(&block,
+                                data + header.index_offset + i * sizeof(block),
+                                sizeof(block));
+                    const uint64_t expectedCount =
+                        std::min<uint64_t>(header.block_size,
+                                           header.records_count - i * header.block_size);
+                    if (block.records_count != expectedCount ||
+                        block.records_count > block.size / min_compressed_record_size ||
+                        block.offset < blocksEnd || block.offset > header.index_offset ||
+                        block.size > header.index_offset - block.offset)
+                    {
+                        return false;
+                    }
+                    blocksEnd = block.offset + block.size;
+                }
+                return true;
+            }
+        }
+
+        /**
+         * Writes records to a compressed capture file. Words are XORed with the previous word
+         * with the same label and only the changed bytes are stored, so slowly changing data
+         * takes a few bytes per record. The header and the block index are written on close.
+         */
+        class compressed_capture_writer
+        {
+        public:
+            explicit compressed_capture_writer(uint32_t blockSize = capture_default_block_size)
+              : block_size_(blockSize ? blockSize : capture_default_block_size)
+            {
+            }
+
+            compressed_capture_writer(const compressed_capture_writer &) = delete;
+            compressed_capture_writer &operator=(const compressed_capture_writer &) = delete;
+
+            ~compressed_capture_writer() { close(); }
+
+            /**
+             * Create or truncate a compressed capture file.
+             * @return false if the file can not be opened.
+             */
+            bool open(const char *path)
+            {
+                close();
+                file_ = std::fopen(path, "wb");
+                if (!file_)
+                {
+                    return false;
+                }
+
+                records_count_ = 0;
+                offset_ = sizeof(capture_header);
+                blocks_.clear();
+                encoder_.reset();
+                const capture_header header{};
+                return write_bytes(&header, sizeof(header));
+            }
+
+            bool is_open() const { return file_ != nullptr; }
+
+            bool write(const capture_record &record) { return write(&record, 1); }
+
+            /**
+             * Append n records. Records are written to the file by blocks.
+             * @return false on error.
+             */
+            bool write(const capture_record *records, size_t n)
+            {
+                if (!file_)
+                {
+                    return false;
+                }
+
+                bool written = true;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    if (encoder_.records_count() == 0)
+                    {
+                        blocks_.push_back(compressed_capture_block{
+                            offset_, 0, 0, records[i].timestamp, records[i].timestamp, {} });
+                    }
+
+                    compressed_capture_block &block = blocks_.back();
+                    block.first_timestamp = std::min(block.first_timestamp, records[i].timestamp);
+                    block.last_timestamp = std::max(block.last_timestamp, records[i].timestamp);
+                    block.labels.insert(uint8_t(detail::bit_field<1, 8>::extract(records[i].word)));
+                    encoder_.encode(records[i]);
+                    ++records_count_;
+
+                    if (encoder_.records_count() == block_size_)
+                    {
+                        written = flush_block() && written;
+                    }
+                }
+                return written;
+            }
+
+            /**
+             * Write the last block, the block index and the header and close the file.
+             * @return false on error.
+             */
+            bool close()
+            {
+                if (!file_)
+                {
+                    return true;
+                }
+
+                bool written = encoder_.records_count() == 0 || flush_block();
+
+                // the index is accessed in place
+                const uint8_t padding[alignof(compressed_capture_block)]{};
+                const size_t paddingSize = size_t(-offset_ % alignof(compressed_capture_block));
+                written = write_bytes(padding, paddingSize) && written;
+                offset_ += paddingSize;
+
+                capture_header header{};
+                std::memcpy(header.magic,
+                            detail::compressed_capture_magic,
+                            sizeof(header.magic));
+                header.version = compressed_capture_version;
+                header.header_size = sizeof(capture_header);
+                header.record_size = sizeof(capture_record);
+                header.records_count = records_count_;
+                header.index_offset = offset_;
+                header.block_size = block_size_;
+
+                written = written && write_bytes(blocks_.data(),
+                                                 blocks_.size() * sizeof(compressed_capture_block));
+                written = written && std::fseek(file_, 0, SEEK_SET) == 0 &&
+                          write_bytes(&header, sizeof(header));
+                written = std::fclose(file_) == 0 && written;
+                file_ = nullptr;
+                return written;
+            }
+
+        private:
+            bool flush_block()
+            {
+                compressed_capture_block &block = blocks_.back();
+                block.size = uint32_t(encoder_.bytes().size());
+                block.records_count = uint32_t(encoder_.records_count());
+                offset_ += block.size;
+
+                const bool written = write_bytes(encoder_.bytes().data(), block.size);
+                encoder_.reset();
+                return written;
+            }
+
+            bool write_bytes(const void *data, size_t size)
+            {
+                return size == 0 || std::fwrite(data, 1, size, file_) == size;
+            }
+
+            uint32_t block_size_;
+            std::FILE *file_ = nullptr;
+            uint64_t records_count_ = 0;
+            uint64_t offset_ = 0;
+            std::vector<compressed_capture_block> blocks_;
+            detail::capture_block_encoder encoder_;
+        };
+
+        /**
+         * Read-only access to a compressed capture file. Blocks are decoded independently, so
+         * any block may be decoded without the preceding ones, e.g. the blocks with a label or
+         * from a point in time found through the block index. Decoded records may be passed to
+         * replay_engine.
+         */
+        class compressed_capture_reader
+        {
+        public:
+            compressed_capture_reader() = default;
+
+            compressed_capture_reader(const compressed_capture_reader &) = delete;
+            compressed_capture_reader &operator=(const compressed_capture_reader &) = delete;
+
+            /**
+             * Open and validate a compressed capture file. Blocks are validated when decoded.
+             * @return false if the file can not be read or is not a valid compressed capture.
+             */
+            bool open(const char *path)
+            {
+                close();
+                if (!detail::is_little_endian() || !file_.open(path))
+                {
+                    return false;
+                }
+
+                if (!detail::is_valid_compressed_capture(file_.data(), file_.size()))
+                {
+                    close();
+                    return false;
+                }
+                std::memcpy(&header_, file_.data(), sizeof(header_));
+                return true;
+            }
+
+            void close()
+            {
+                file_.close();
+                header_ = capture_header{};
+            }
+
+            bool is_open() const { return file_.is_open(); }
+
+            const capture_header &header() const { return header_; }
+
+            size_t records_count() const { return size_t(header_.records_count); }
+
+            size_t blocks_count() const
+            {
+                return header_.block_size
+                           ? size_t(header_.records_count / header_.block_size +
+                                    (header_.records_count % header_.block_size != 0))
+                           : 0;
+            }
+
+            const compressed_capture_block &block_info(size_t index) const
+            {
+                return blocks()[index];
+            }
+
+            const capture_block_labels &block_labels(size_t index) const
+            {
+                return block_info(index).labels;
+            }
+
+            /**
+             * Find the first block with records at or after a point in time, e.g. to start a
+             * replay from it. Binary search, last timestamps of blocks do not decrease.
+             * @return blocks_count() if all records are earlier.
+             */
+            size_t find_block(uint64_t timestamp) const
+            {
+                const compressed_capture_block *const first = blocks();
+                const auto *const found =
+                    std::partition_point(first,
+                                         first + blocks_count(),
+                                         [timestamp](const compressed_capture_block &block) {
+                                             return block.last_timestamp < timestamp;
+                                         });
+                return size_t(found - first);
+            }
+
+            /**
+             * Decode records of a block.
+             * @return false if the block is corrupted.
+             */
+            bool decode_block(size_t index, std::vector<capture_record> &out) const
+            {
+                out.resize(block_info(index).records_count);
+                return decode_block(index, out.data());
+            }
+
+            /**
+             * Decode count blocks starting from first into contiguous records, decoding blocks
+             * on threadsCount threads, including the calling one.
+             * @return false if a block is corrupted.
+             */
+            bool decode_blocks(size_t first,
+                               size_t count,
+                               std::vector<capture_record> &out,
+                               size_t threadsCount = 1) const
+            {
+                if (count == 0)
+                {
+                    out.clear();
+                    return true;
+                }
+
+                const size_t last = first + count - 1;
+                out.resize(size_t(last - first) * header_.block_size +
+                           block_info(last).records_count);
+
+                std::atomic<size_t> next{ first };
+                std::atomic<bool> decoded{ true };
+                const auto work = [&] {
+                    for (size_t index = next++; index <= last; index = next++)
+                    {
+                        if (!decode_block(index,
+                                          out.data() + (index - first) * header_.block_size))
+                        {
+                            decoded.store(false, std::memory_order_relaxed);
+                        }
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                const size_t workersCount = std::max<size_t>(1, std::min(threadsCount, count));
+                workers.reserve(workersCount - 1);
+                for (size_t worker = 1; worker < workersCount; ++worker)
+                {
+                    workers.emplace_back(work);
+                }
+                work();
+                for (auto &worker : workers)
+                {
+                    worker.join();
+                }
+                return decoded.load();
+            }
+
+            /**
+             * Decode all records.
+             * @return false if a block is corrupted.
+             */
+            bool decode(std::vector<capture_record> &out, size_t threadsCount = 1) const
+            {
+                return decode_blocks(0, blocks_count(), out, threadsCount);
+            }
+
+            /**
+             * Decode each block that has records with the label and call visitor with it.
+             * @param visitor callable with signature void(capture_view).
+             * @return false if a block is corrupted.
+             */
+            template<typename VisitorT>
+            bool for_each_block(uint8_t label, VisitorT &&visitor) const
+            {
+                std::vector<capture_record> records;
+                for (size_t i = 0; i < blocks_count(); ++i)
+                {
+                    if (!block_labels(i).contains(label))
+                    {
+                        continue;
+                    }
+                    if (!decode_block(i, records))
+                    {
+                        return false;
+                    }
+                    visitor(capture_view(records.data(), records.size()));
+                }
+                return true;
+            }
+
+        private:
+            const compressed_capture_block *blocks() const
+            {
+                return reinterpret_cast<const compressed_capture_block *>(file_.data() +
+                                                                          header_.index_offset);
+            }
+
+            bool decode_block(size_t index, capture_record *out) const
+            {
+                const compressed_capture_block &block = block_info(index);
+                return detail::decode_capture_block(file_.data() + block.offset,
+                                                    block.size,
+                                                    block.records_count,
+                                                    out);
+            }
+
+            detail::mapped_file file_;
+            capture_header header_{};
+        };
+    }
+}
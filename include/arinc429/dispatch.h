@@ -0,0 +1,175 @@
+﻿#pragma once
+
+#include "arinc429/arinc429.h"
+
+/**
+ * Dispatch of raw words of a mixed-label stream to handlers of the matching word types.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Binds a word type to the label it is transmitted with.
+         * @tparam Label label octet as stored in bits 1-8 of a raw word.
+         * @tparam WordT word_generic type.
+         */
+        template<uint8_t Label, typename WordT>
+        struct label_word
+        {
+            using word_type = WordT;
+
+            static constexpr uint8_t label() { return Label; }
+        };
+
+        /**
+         * Binds a word type to its label number, for words with label_descriptor labels
+         * (label bits are stored in transmission order, i.e. reversed).
+         * @tparam LabelNumber label number as returned by label_descriptor.
+         * @tparam WordT word_generic type.
+         */
+        template<uint8_t LabelNumber, typename WordT>
+        using reversed_label_word = label_word<detail::reverse_bits(LabelNumber), WordT>;
+
+        /**
+         * Instrumentation policy that does nothing, the default of the dispatcher and the cache.
+         * A policy defines:
+         * - static void received(traits::word_raw_type wordRaw), called for each received word;
+         * - decode_scope, constructed from the label before a word is decoded and destroyed
+         * after it.
+         */
+        struct null_instrumentation
+        {
+            struct decode_scope
+            {
+                constexpr explicit decode_scope(uint8_t /*label*/) {}
+            };
+
+            static void received(traits::word_raw_type /*wordRaw*/) {}
+        };
+
+        namespace detail
+        {
+            using label_field_t = bit_field<1, 8>;
+
+            constexpr size_t labels_count = size_t(1) << label_field_t::width();
+
+            constexpr bool contains(uint8_t /*value*/) { return false; }
+
+            template<typename... ArgsT>
+            constexpr bool contains(uint8_t value, uint8_t first, ArgsT... args)
+            {
+                return value == first || contains(value, args...);
+            }
+
+            constexpr bool are_unique() { return true; }
+
+            /**
+             * Check that there are no equal arguments.
+             */
+            template<typename... ArgsT>
+            constexpr bool are_unique(uint8_t first, ArgsT... args)
+            {
+                return !contains(first, args...) && are_unique(args...);
+            }
+
+            template<typename Handler>
+            using dispatch_entry_t = bool (*)(Handler &, traits::word_raw_type);
+
+            template<typename InstrumentationT, typename Handler, typename... LabelWords>
+            struct dispatch_table
+            {
+                constexpr dispatch_table()   //
+                  : entries{}
+                {
+                    for (auto &entry : entries)
+                    {
+                        entry = &unhandled;
+                    }
+
+                    const int expand[]{
+                        0,
+                        (entries[LabelWords::label()] = &handle<LabelWords>, 0)...
+                    };
+                    (void)expand;
+                }
+
+                static bool unhandled(Handler &, traits::word_raw_type) { return false; }
+
+                template<typename LabelWordT>
+                static bool handle(Handler &handler, traits::word_raw_type wordRaw)
+                {
+                    const typename InstrumentationT::decode_scope scope(LabelWordT::label());
+                    handler(typename LabelWordT::word_type(wordRaw));
+                    return true;
+                }
+
+                dispatch_entry_t<Handler> entries[labels_count];
+            };
+        }
+
+        /**
+         * Calls a handler with the word type bound to the label of a raw word.
+         * Dispatch is a single lookup in a 256-entry table built at compile time.
+         * @tparam InstrumentationT instrumentation policy, see null_instrumentation.
+         * @tparam LabelWords label_word bindings.
+         */
+        template<typename InstrumentationT, typename... LabelWords>
+        class basic_label_dispatcher
+        {
+        public:
+            /**
+             * Dispatch a single raw word.
+             * @param wordRaw raw word.
+             * @param handler callable accepting each of the bound word types.
+             * @return false if no word type is bound to the label of the word.
+             */
+            template<typename Handler>
+            bool dispatch(traits::word_raw_type wordRaw, Handler &&handler) const
+            {
+                InstrumentationT::received(wordRaw);
+                return table<std::remove_reference_t<Handler>>()
+                    .entries[detail::label_field_t::extract(wordRaw)](handler, wordRaw);
+            }
+
+            /**
+             * Dispatch n raw words in order.
+             * @return number of words with a bound word type.
+             */
+            template<typename Handler>
+            size_t dispatch(const traits::word_raw_type *in, size_t n, Handler &&handler) const
+            {
+                const auto &entries = table<std::remove_reference_t<Handler>>().entries;
+
+                size_t handled = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    InstrumentationT::received(in[i]);
+                    handled += entries[detail::label_field_t::extract(in[i])](handler, in[i]);
+                }
+                return handled;
+            }
+
+        private:
+            static_assert(detail::are_unique(LabelWords::label()...),
+                          "Multiple word types are bound to the same label!");
+
+            template<typename Handler>
+            using table_t = detail::dispatch_table<InstrumentationT, Handler, LabelWords...>;
+
+            template<typename Handler>
+            static const table_t<Handler> &table()
+            {
+                static constexpr table_t<Handler> dispatchTable{};
+                return dispatchTable;
+            }
+        };
+
+        /**
+         * Dispatcher without instrumentation.
+         */
+        template<typename... LabelWords>
+        using label_dispatcher = basic_label_dispatcher<null_instrumentation, LabelWords...>;
+    }
+}
@@ -0,0 +1,278 @@
+﻿#pragma once
+
+#include "arinc429/arinc429.h"
+
+#include <cstring>
+
+/**
+ * Runtime access to data of words by string names, e.g. ICD names used by user interfaces and
+ * scripts. A data descriptor is given a name by defining
+ * static constexpr const char *name() { return "..."; }
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Type-erased data descriptor.
+         */
+        struct field_info
+        {
+            const char *name;
+            size_t lsb;
+            size_t msb;
+            /**
+             * Value of the least significant bit as returned by get: 1 for integral values
+             * unless scaled with fixed_scale.
+             */
+            double scale;
+            double (*get)(traits::word_raw_type wordRaw);
+            traits::word_raw_type (*set)(traits::word_raw_type wordRaw, double value);
+        };
+
+        namespace detail
+        {
+            template<typename DataDescriptor, typename = void>
+            struct has_field_name : std::false_type
+            {
+            };
+
+            template<typename DataDescriptor>
+            struct has_field_name<DataDescriptor, void_t<decltype(DataDescriptor::name())>>
+              : std::true_type
+            {
+            };
+
+            template<typename DataDescriptor>
+            constexpr const char *field_name(std::true_type)
+            {
+                return DataDescriptor::name();
+            }
+
+            template<typename DataDescriptor>
+            constexpr const char *field_name(std::false_type)
+            {
+                return nullptr;
+            }
+
+            /**
+             * Scale of any ScaleFactorT with num and den members, e.g. std::ratio, same as
+             * decoding of data: only floating point values are scaled.
+             */
+            template<typename ScaleFactorT, typename ValueT>
+            struct scale_of
+            {
+                static constexpr double value()
+                {
+                    return std::is_floating_point<ValueT>::value
+                               ? double(ScaleFactorT::num) / double(ScaleFactorT::den)
+                               : 1.0;
+                }
+            };
+
+            template<typename Ratio, typename ValueT>
+            struct scale_of<fixed_scale<Ratio>, ValueT>
+            {
+                static constexpr double value()
+                {
+                    using ratio = typename fixed_scale<Ratio>::ratio;
+                    return double(ratio::num) / double(ratio::den);
+                }
+            };
+
+            template<typename DataDescriptor>
+            double get_field(traits::word_raw_type wordRaw)
+            {
+                traits::value_type_t<DataDescriptor> value{};
+                arinc429::get_value<DataDescriptor>(value, wordRaw);
+                return double(value);
+            }
+
+            template<typename DataDescriptor>
+            traits::word_raw_type set_field(traits::word_raw_type wordRaw, double value)
+            {
+                arinc429::set_value<DataDescriptor>(traits::value_type_t<DataDescriptor>(value),
+                                                    wordRaw);
+                return wordRaw;
+            }
+
+            template<typename DataDescriptor>
+            constexpr field_info make_field_info()
+            {
+                return field_info{ field_name<DataDescriptor>(has_field_name<DataDescriptor>()),
+                                   traits::data_descriptor_traits<DataDescriptor>::lsb(),
+                                   traits::data_descriptor_traits<DataDescriptor>::msb(),
+                                   scale_of<traits::scale_factor_type_t<DataDescriptor>,
+                                            traits::value_type_t<DataDescriptor>>::value(),
+                                   &get_field<DataDescriptor>,
+                                   &set_field<DataDescriptor> };
+            }
+
+            /**
+             * FNV-1a hash of a null-terminated string, mixed with seed.
+             */
+            constexpr uint32_t hash_name(const char *name, uint32_t seed)
+            {
+                uint32_t hash = 2166136261u ^ seed;
+                for (; *name; ++name)
+                {
+                    hash = (hash ^ uint8_t(*name)) * 16777619u;
+                }
+                return hash ^ (hash >> 15);
+            }
+
+            constexpr size_t hash_table_size(size_t count)
+            {
+                size_t size = 1;
+                while (size < 2 * count)
+                {
+                    size *= 2;
+                }
+                return size;
+            }
+
+            constexpr uint32_t no_seed = std::numeric_limits<uint32_t>::max();
+
+            /**
+             * Find a seed that maps the names to different slots of a table of size Size.
+             * nullptr names are skipped.
+             * @return no_seed if there is no such seed or names are not unique.
+             */
+            template<size_t Size, size_t N>
+            constexpr uint32_t find_perfect_seed(const field_info (&fields)[N])
+            {
+                for (uint32_t seed = 0; seed < 1024; ++seed)
+                {
+                    bool perfect = true;
+                    for (size_t i = 0; i < N && perfect; ++i)
+                    {
+                        for (size_t j = 0; j < i && perfect && fields[i].name; ++j)
+                        {
+                            perfect = !fields[j].name ||
+                                      (hash_name(fields[i].name, seed) & (Size - 1)) !=
+                                          (hash_name(fields[j].name, seed) & (Size - 1));
+                        }
+                    }
+                    if (perfect)
+                    {
+                        return seed;
+                    }
+                }
+                return no_seed;
+            }
+
+            template<typename TupleDescriptors>
+            struct field_table_data;
+
+            template<typename... DataDescriptors>
+            struct field_table_data<std::tuple<DataDescriptors...>>
+            {
+                static constexpr size_t fields_count = sizeof...(DataDescriptors);
+                static constexpr size_t table_size = hash_table_size(fields_count);
+
+                constexpr field_table_data()   //
+                  : fields{ make_field_info<DataDescriptors>()... },
+                    seed(find_perfect_seed<table_size>(fields)),
+                    slots{}
+                {
+                    for (auto &slot : slots)
+                    {
+                        slot = fields_count;
+                    }
+                    for (size_t i = 0; i < fields_count; ++i)
+                    {
+                        if (fields[i].name)
+                        {
+                            slots[hash_name(fields[i].name, seed) & (table_size - 1)] = i;
+                        }
+                    }
+                }
+
+                field_info fields[fields_count];
+                uint32_t seed;
+                /**
+                 * Index of the field for each slot, fields_count for empty slots.
+                 */
+                size_t slots[table_size];
+            };
+        }
+
+        /**
+         * Perfect hash table from names of data descriptors of WordT to field_info, generated at
+         * compile time. A lookup hashes the name and compares it with a single candidate.
+         * Data descriptors without names are not included.
+         * @tparam WordT word_generic type.
+         */
+        template<typename WordT>
+        class field_table
+        {
+            using tuple_descriptors = typename traits::word_traits<WordT>::tuple_descriptors;
+            using data_type = detail::field_table_data<tuple_descriptors>;
+
+        public:
+            /**
+             * Find a field by name.
+             * @return nullptr if there is no field with the name.
+             */
+            static const field_info *find(const char *name)
+            {
+                const data_type &tableData = data();
+                const size_t index = tableData.slots[detail::hash_name(name, tableData.seed) &
+                                                     (data_type::table_size - 1)];
+                if (index == data_type::fields_count ||
+                    std::strcmp(tableData.fields[index].name, name) != 0)
+                {
+                    return nullptr;
+                }
+                return &tableData.fields[index];
+            }
+
+            /**
+             * Get data with the name.
+             * @return false if there is no field with the name.
+             */
+            static bool get(const WordT &word, const char *name, double &value)
+            {
+                const field_info *field = find(name);
+                if (!field)
+                {
+                    return false;
+                }
+                value = field->get(word.get_raw());
+                return true;
+            }
+
+            /**
+             * Set data with the name.
+             * @return false if there is no field with the name.
+             */
+            static bool set(WordT &word, const char *name, double value)
+            {
+                const field_info *field = find(name);
+                if (!field)
+                {
+                    return false;
+                }
+                word.set_raw(field->set(word.get_raw(), value));
+                return true;
+            }
+
+            /**
+             * All fields in order of data descriptors, including the ones without names.
+             */
+            static const field_info *begin() { return data().fields; }
+
+            static const field_info *end() { return data().fields + data_type::fields_count; }
+
+        private:
+            static const data_type &data()
+            {
+                static constexpr data_type tableData{};
+                static_assert(tableData.seed != detail::no_seed,
+                              "Names of data descriptors must be unique!");
+                return tableData;
+            }
+        };
+    }
+}
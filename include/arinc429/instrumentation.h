@@ -0,0 +1,311 @@
+﻿#pragma once
+
+#include "arinc429/dispatch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+/**
+ * Per-label counters of received words for the instrumentation policy of the dispatcher and
+ * the cache.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Aggregated counters of a label.
+         */
+        struct label_statistics
+        {
+            uint64_t words;
+            uint64_t parity_errors;
+            /**
+             * Number of words with each SSM code, e.g. ssm[uint8_t(bnr_ssm::failure_warning)].
+             */
+            uint64_t ssm[4];
+            uint64_t decodes;
+            uint64_t decode_nanoseconds;
+            /**
+             * Number of intervals between consecutive words received by a thread.
+             */
+            uint64_t intervals;
+            uint64_t interval_min_nanoseconds;
+            uint64_t interval_max_nanoseconds;
+            double interval_sum_nanoseconds;
+            double interval_sum_squares;
+
+            double mean_interval_nanoseconds() const
+            {
+                return intervals ? interval_sum_nanoseconds / double(intervals) : 0.0;
+            }
+
+            /**
+             * Standard deviation of the intervals between words.
+             */
+            double interval_jitter_nanoseconds() const
+            {
+                if (!intervals)
+                {
+                    return 0.0;
+                }
+                const double mean = mean_interval_nanoseconds();
+                return std::sqrt(
+                    std::max(0.0, interval_sum_squares / double(intervals) - mean * mean));
+            }
+        };
+
+        namespace detail
+        {
+            /**
+             * Counters of a label written by a single thread. Other threads only read them.
+             */
+            struct label_counters
+            {
+                static void add(std::atomic<uint64_t> &counter, uint64_t value)
+                {
+                    counter.store(counter.load(std::memory_order_relaxed) + value,
+                                  std::memory_order_relaxed);
+                }
+
+                static void add(std::atomic<double> &counter, double value)
+                {
+                    counter.store(counter.load(std::memory_order_relaxed) + value,
+                                  std::memory_order_relaxed);
+                }
+
+                void add_interval(uint64_t interval)
+                {
+                    add(intervals, 1);
+                    add(interval_sum, double(interval));
+                    add(interval_sum_squares, double(interval) * double(interval));
+                    if (interval < interval_min.load(std::memory_order_relaxed))
+                    {
+                        interval_min.store(interval, std::memory_order_relaxed);
+                    }
+                    if (interval > interval_max.load(std::memory_order_relaxed))
+                    {
+                        interval_max.store(interval, std::memory_order_relaxed);
+                    }
+                }
+
+                label_statistics load() const
+                {
+                    label_statistics statistics{};
+                    statistics.words = words.load(std::memory_order_relaxed);
+                    statistics.parity_errors = parity_errors.load(std::memory_order_relaxed);
+                    for (size_t code = 0; code < 4; ++code)
+                    {
+                        statistics.ssm[code] = ssm[code].load(std::memory_order_relaxed);
+                    }
+                    statistics.decodes = decodes.load(std::memory_order_relaxed);
+                    statistics.decode_nanoseconds =
+                        decode_nanoseconds.load(std::memory_order_relaxed);
+                    statistics.intervals = intervals.load(std::memory_order_relaxed);
+                    statistics.interval_min_nanoseconds =
+                        interval_min.load(std::memory_order_relaxed);
+                    statistics.interval_max_nanoseconds =
+                        interval_max.load(std::memory_order_relaxed);
+                    statistics.interval_sum_nanoseconds =
+                        interval_sum.load(std::memory_order_relaxed);
+                    statistics.interval_sum_squares =
+                        interval_sum_squares.load(std::memory_order_relaxed);
+                    return statistics;
+                }
+
+                std::atomic<uint64_t> words{ 0 };
+                std::atomic<uint64_t> parity_errors{ 0 };
+                std::atomic<uint64_t> ssm[4]{};
+                std::atomic<uint64_t> decodes{ 0 };
+                std::atomic<uint64_t> decode_nanoseconds{ 0 };
+                std::atomic<uint64_t> intervals{ 0 };
+                std::atomic<uint64_t> interval_min{ std::numeric_limits<uint64_t>::max() };
+                std::atomic<uint64_t> interval_max{ 0 };
+                std::atomic<double> interval_sum{ 0.0 };
+                std::atomic<double> interval_sum_squares{ 0.0 };
+                /**
+                 * Time of the last word, owner thread only.
+                 */
+                uint64_t last_received = 0;
+            };
+
+            inline void accumulate(label_statistics &to, const label_statistics &from)
+            {
+                to.words += from.words;
+                to.parity_errors += from.parity_errors;
+                for (size_t code = 0; code < 4; ++code)
+                {
+                    to.ssm[code] += from.ssm[code];
+                }
+                to.decodes += from.decodes;
+                to.decode_nanoseconds += from.decode_nanoseconds;
+                if (!from.intervals)
+                {
+                    return;
+                }
+
+                to.interval_min_nanoseconds =
+                    to.intervals ? std::min(to.interval_min_nanoseconds,
+                                            from.interval_min_nanoseconds)
+                                 : from.interval_min_nanoseconds;
+                to.interval_max_nanoseconds =
+                    std::max(to.interval_max_nanoseconds, from.interval_max_nanoseconds);
+                to.intervals += from.intervals;
+                to.interval_sum_nanoseconds += from.interval_sum_nanoseconds;
+                to.interval_sum_squares += from.interval_sum_squares;
+            }
+        }
+
+        /**
+         * Instrumentation policy that counts received words, parity errors and SSM codes, and
+         * measures decode time and intervals between words of each label.
+         * Each thread records into its own cache-line aligned counters, so recording never
+         * contends. aggregate() sums the counters of all threads, including the finished ones.
+         * @tparam Tag type to keep independent sets of counters.
+         */
+        template<typename Tag = void>
+        class counting_instrumentation
+        {
+            using clock_type = std::chrono::steady_clock;
+
+        public:
+            class decode_scope
+            {
+            public:
+                explicit decode_scope(uint8_t label)
+                  : label_(label),
+                    start_(now())
+                {
+                }
+
+                decode_scope(const decode_scope &) = delete;
+                decode_scope &operator=(const decode_scope &) = delete;
+
+                ~decode_scope()
+                {
+                    detail::label_counters &counters = local().labels[label_];
+                    detail::label_counters::add(counters.decodes, 1);
+                    detail::label_counters::add(counters.decode_nanoseconds, now() - start_);
+                }
+
+            private:
+                uint8_t label_;
+                uint64_t start_;
+            };
+
+            static void received(traits::word_raw_type wordRaw)
+            {
+                detail::label_counters &counters =
+                    local().labels[detail::label_field_t::extract(wordRaw)];
+                detail::label_counters::add(counters.words, 1);
+                detail::label_counters::add(counters.parity_errors, !validate_parity(wordRaw));
+                detail::label_counters::add(counters.ssm[detail::ssm_field_t::extract(wordRaw)],
+                                            1);
+
+                const uint64_t time = now();
+                if (counters.last_received)
+                {
+                    counters.add_interval(time - counters.last_received);
+                }
+                counters.last_received = time;
+            }
+
+            /**
+             * Sum the counters of all threads.
+             */
+            static void aggregate(label_statistics (&statistics)[detail::labels_count])
+            {
+                registry_type &threads = registry();
+                std::lock_guard<std::mutex> lock(threads.mutex);
+                for (size_t label = 0; label < detail::labels_count; ++label)
+                {
+                    statistics[label] = threads.collect(label);
+                }
+            }
+
+            static label_statistics aggregate(uint8_t label)
+            {
+                registry_type &threads = registry();
+                std::lock_guard<std::mutex> lock(threads.mutex);
+                return threads.collect(label);
+            }
+
+        private:
+            struct alignas(64) thread_counters
+            {
+                detail::label_counters labels[detail::labels_count];
+            };
+
+            struct registry_type
+            {
+                label_statistics collect(size_t label) const
+                {
+                    label_statistics statistics = finished[label];
+                    for (const thread_counters *counters : running)
+                    {
+                        detail::accumulate(statistics, counters->labels[label].load());
+                    }
+                    return statistics;
+                }
+
+                std::mutex mutex;
+                std::vector<const thread_counters *> running;
+                label_statistics finished[detail::labels_count]{};
+            };
+
+            /**
+             * Counters of the calling thread, registered on the first use and merged into the
+             * finished counters when the thread exits.
+             */
+            struct local_counters : thread_counters
+            {
+                local_counters()
+                {
+                    registry_type &threads = registry();
+                    std::lock_guard<std::mutex> lock(threads.mutex);
+                    threads.running.push_back(this);
+                }
+
+                ~local_counters()
+                {
+                    registry_type &threads = registry();
+                    std::lock_guard<std::mutex> lock(threads.mutex);
+                    threads.running.erase(
+                        std::find(threads.running.begin(), threads.running.end(), this));
+                    for (size_t label = 0; label < detail::labels_count; ++label)
+                    {
+                        detail::accumulate(threads.finished[label], this->labels[label].load());
+                    }
+                }
+            };
+
+            static uint64_t now()
+            {
+                return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    clock_type::now().time_since_epoch())
+                                    .count());
+            }
+
+            /**
+             * Never destroyed: thread_local counters may be destroyed after function-local
+             * statics at exit and still merge into the registry.
+             */
+            static registry_type &registry()
+            {
+                static registry_type *threads = new registry_type;
+                return *threads;
+            }
+
+            static thread_counters &local()
+            {
+                static thread_local local_counters counters;
+                return counters;
+            }
+        };
+    }
+}
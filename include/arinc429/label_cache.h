@@ -0,0 +1,272 @@
+﻿#pragma once
+
+#include "arinc429/dispatch.h"
+
+#include <atomic>
+
+/**
+ * Cache of the latest received word of each label with change detection.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        namespace detail
+        {
+            template<uint8_t Label, typename... LabelWords>
+            struct find_label_word;
+
+            template<uint8_t Label, typename LabelWordT, typename... LabelWords>
+            struct find_label_word<Label, LabelWordT, LabelWords...>
+              : std::conditional_t<LabelWordT::label() == Label,
+                                   LabelWordT,
+                                   find_label_word<Label, LabelWords...>>
+            {
+            };
+
+            template<uint8_t Label>
+            struct find_label_word<Label>
+            {
+                static_assert(Label != Label, "No word type is bound to the label!");
+            };
+
+            template<typename... LabelWords>
+            struct bound_labels
+            {
+                constexpr bound_labels()   //
+                  : bound{}
+                {
+                    const int expand[]{ 0, (bound[LabelWords::label()] = true, 0)... };
+                    (void)expand;
+                }
+
+                bool bound[labels_count];
+            };
+        }
+
+        /**
+         * Latest received raw word of each bound label. Words are written by a single writer,
+         * any number of readers may read concurrently without blocking it.
+         * A bit is kept for each slot that is set when a different word is received and cleared
+         * when it is collected with take_changed, so readers can decode only changed words.
+         * Consistent snapshots of the whole cache are taken using a sequence lock.
+         * @tparam SdiSlots 1 for a slot per label, 4 for a slot per label and SDI.
+         * @tparam InstrumentationT instrumentation policy, see null_instrumentation.
+         * @tparam LabelWords label_word bindings.
+         */
+        template<size_t SdiSlots, typename InstrumentationT, typename... LabelWords>
+        class basic_label_cache
+        {
+            static_assert(SdiSlots == 1 || SdiSlots == detail::sdi_count,
+                          "There must be a slot per label or per label and SDI!");
+            static_assert(detail::are_unique(LabelWords::label()...),
+                          "Multiple word types are bound to the same label!");
+
+            static constexpr size_t slots_count_ = detail::labels_count * SdiSlots;
+            static constexpr size_t mask_size_ = slots_count_ / 64;
+
+        public:
+            template<uint8_t Label>
+            using word_type_t = typename detail::find_label_word<Label, LabelWords...>::word_type;
+
+            static constexpr size_t slots_count() { return slots_count_; }
+
+            /**
+             * Number of 64-bit elements in a mask with a bit per slot.
+             */
+            static constexpr size_t mask_size() { return mask_size_; }
+
+            /**
+             * Copy of all slots at one point in time.
+             */
+            struct snapshot_type
+            {
+                traits::word_raw_type words[slots_count_];
+                uint64_t received[mask_size_];
+            };
+
+            /**
+             * Store a raw word if its label is bound. Writer only.
+             * @return false if no word type is bound to the label of the word.
+             */
+            bool update(traits::word_raw_type wordRaw)
+            {
+                InstrumentationT::received(wordRaw);
+                if (!is_bound(wordRaw))
+                {
+                    return false;
+                }
+
+                const uint32_t sequence = begin_write();
+                store(wordRaw);
+                end_write(sequence);
+                return true;
+            }
+
+            /**
+             * Store n raw words in order, e.g. a block passed by spsc_ring::consume.
+             * Writer only.
+             * @return number of words with a bound label.
+             */
+            size_t update(const traits::word_raw_type *in, size_t n)
+            {
+                const uint32_t sequence = begin_write();
+                size_t stored = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    InstrumentationT::received(in[i]);
+                    if (is_bound(in[i]))
+                    {
+                        store(in[i]);
+                        ++stored;
+                    }
+                }
+                end_write(sequence);
+                return stored;
+            }
+
+            /**
+             * Get the latest word of a label.
+             * @param sdi SDI of the word, must be 0 for a slot per label.
+             * @return false if no word with the label has been received.
+             */
+            template<uint8_t Label>
+            bool get(word_type_t<Label> &word, uint8_t sdi = 0) const
+            {
+                traits::word_raw_type wordRaw = 0;
+                if (!get_raw(Label, wordRaw, sdi))
+                {
+                    return false;
+                }
+                word = word_type_t<Label>(wordRaw);
+                return true;
+            }
+
+            /**
+             * Get the latest raw word of a label.
+             * @return false if no word with the label has been received.
+             */
+            bool get_raw(uint8_t label, traits::word_raw_type &wordRaw, uint8_t sdi = 0) const
+            {
+                const size_t slot = slot_index(label, sdi);
+                if (!test(received_, slot))
+                {
+                    return false;
+                }
+                wordRaw = words_[slot].load(std::memory_order_relaxed);
+                return true;
+            }
+
+            /**
+             * Collect and clear the changed bits: bit i of mask[i / 64] is set for slot i,
+             * which is label + 256 * SDI.
+             */
+            void take_changed(uint64_t (&mask)[mask_size_])
+            {
+                for (size_t i = 0; i < mask_size_; ++i)
+                {
+                    mask[i] = changed_[i].exchange(0, std::memory_order_acquire);
+                }
+            }
+
+            /**
+             * Copy all slots. Retries while the writer is updating the cache.
+             */
+            void snapshot(snapshot_type &out) const
+            {
+                uint32_t before = 0;
+                uint32_t after = 0;
+                do
+                {
+                    // acquire loads of the slots keep the second load of the sequence after
+                    // them and see the odd sequence of a write they overlap, without fences
+                    before = sequence_.load(std::memory_order_acquire);
+                    for (size_t i = 0; i < slots_count_; ++i)
+                    {
+                        out.words[i] = words_[i].load(std::memory_order_acquire);
+                    }
+                    for (size_t i = 0; i < mask_size_; ++i)
+                    {
+                        out.received[i] = received_[i].load(std::memory_order_acquire);
+                    }
+                    after = sequence_.load(std::memory_order_relaxed);
+                } while ((before & 1u) != 0 || before != after);
+            }
+
+        private:
+            static constexpr detail::bound_labels<LabelWords...> bound_labels_{};
+
+            static bool is_bound(traits::word_raw_type wordRaw)
+            {
+                return bound_labels_.bound[detail::label_field_t::extract(wordRaw)];
+            }
+
+            static size_t slot_index(uint8_t label, uint8_t sdi)
+            {
+                return label + detail::labels_count * (sdi & (SdiSlots - 1));
+            }
+
+            static bool test(const std::atomic<uint64_t> (&mask)[mask_size_], size_t slot)
+            {
+                return (mask[slot / 64].load(std::memory_order_acquire) >> slot % 64) & 1u;
+            }
+
+            uint32_t begin_write()
+            {
+                const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+                sequence_.store(sequence + 1, std::memory_order_relaxed);
+                return sequence;
+            }
+
+            void end_write(uint32_t sequence)
+            {
+                sequence_.store(sequence + 2, std::memory_order_release);
+            }
+
+            void store(traits::word_raw_type wordRaw)
+            {
+                const size_t slot =
+                    slot_index(detail::label_field_t::extract(wordRaw),
+                               uint8_t(detail::sdi_field_t::extract(wordRaw)));
+                const uint64_t bit = uint64_t(1) << slot % 64;
+
+                const bool received = test(received_, slot);
+                if (received && words_[slot].load(std::memory_order_relaxed) == wordRaw)
+                {
+                    return;
+                }
+
+                // release publishes the odd sequence to snapshots that load the word
+                words_[slot].store(wordRaw, std::memory_order_release);
+                if (!received)
+                {
+                    received_[slot / 64].fetch_or(bit, std::memory_order_release);
+                }
+                changed_[slot / 64].fetch_or(bit, std::memory_order_release);
+            }
+
+            std::atomic<uint32_t> sequence_{ 0 };
+            std::atomic<uint64_t> changed_[mask_size_]{};
+            std::atomic<uint64_t> received_[mask_size_]{};
+            std::atomic<traits::word_raw_type> words_[slots_count_]{};
+        };
+
+        template<size_t SdiSlots, typename InstrumentationT, typename... LabelWords>
+        constexpr detail::bound_labels<LabelWords...>
+            basic_label_cache<SdiSlots, InstrumentationT, LabelWords...>::bound_labels_;
+
+        /**
+         * Cache with a slot per label.
+         */
+        template<typename... LabelWords>
+        using label_cache = basic_label_cache<1, null_instrumentation, LabelWords...>;
+
+        /**
+         * Cache with a slot per label and SDI, for labels transmitted by several sources.
+         */
+        template<typename... LabelWords>
+        using sdi_label_cache =
+            basic_label_cache<detail::sdi_count, null_instrumentation, LabelWords...>;
+    }
+}
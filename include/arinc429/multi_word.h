@@ -0,0 +1,387 @@
+﻿#pragma once
+
+#include "arinc429/dispatch.h"
+
+#include <algorithm>
+
+/**
+ * Parameters split across several words, e.g. extended-precision positions.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Part of a multi-word parameter: bits of data with NameType of the word with the label.
+         * Data bits are taken as is, the value type of the data descriptor is not used.
+         * @tparam Label label octet as stored in bits 1-8 of a raw word.
+         * @tparam WordT word_generic type.
+         * @tparam NameType name of the data descriptor of WordT.
+         */
+        template<uint8_t Label, typename WordT, typename NameType>
+        struct multi_word_part : label_word<Label, WordT>
+        {
+            using name_type = NameType;
+            using bit_field_type =
+                detail::descriptor_bit_field_t<traits::get_data_descriptor_t<NameType, WordT>>;
+        };
+
+        /**
+         * Parameter with bits concatenated from parts in consecutive words, the most
+         * significant part first. Signed and floating point values are two's complement, the
+         * sign is the most significant bit of the first part.
+         * @tparam ValueT integral type of up to 64 bits or floating point type.
+         * @tparam ScaleFactorT std::ratio, value of the least significant bit for floating point
+         * values.
+         * @tparam Parts multi_word_part types in order of transmission.
+         */
+        template<typename ValueT, typename ScaleFactorT, typename... Parts>
+        class multi_word
+        {
+            static_assert(sizeof...(Parts) > 0, "There must be at least one part!");
+            static_assert(std::is_arithmetic<ValueT>::value, "Value type must be arithmetic!");
+            static_assert(detail::sum(size_t(0), Parts::bit_field_type::width()...) <= 64,
+                          "Parameter exceeds 64 bits!");
+
+            template<size_t Part>
+            using part_t = std::tuple_element_t<Part, std::tuple<Parts...>>;
+
+            template<size_t Part>
+            using part_field_t = typename part_t<Part>::bit_field_type;
+
+        public:
+            using value_type = ValueT;
+            using scale_factor_type = ScaleFactorT;
+
+            static constexpr size_t parts_count() { return sizeof...(Parts); }
+
+            /**
+             * Number of bits of the parameter.
+             */
+            static constexpr size_t width()
+            {
+                return detail::sum(size_t(0), Parts::bit_field_type::width()...);
+            }
+
+            /**
+             * Label of a part.
+             */
+            static constexpr uint8_t label(size_t part)
+            {
+                const uint8_t labels[]{ Parts::label()... };
+                return labels[part];
+            }
+
+            template<size_t Part>
+            using word_type_t = typename part_t<Part>::word_type;
+
+            constexpr multi_word() = default;
+
+            /**
+             * @param words parts_count() raw words in order of parts.
+             */
+            explicit multi_word(const traits::word_raw_type *words)
+            {
+                std::copy(words, words + parts_count(), words_);
+            }
+
+            /**
+             * Decode a parameter from parts_count() raw words in order of parts.
+             */
+            static value_type decode(const traits::word_raw_type *words)
+            {
+                return to_value(concatenate(words, std::index_sequence_for<Parts...>()),
+                                value_category());
+            }
+
+            /**
+             * Encode a parameter into the bits of parts of parts_count() raw words. Other bits
+             * of the words are kept.
+             */
+            static void encode(const value_type &value, traits::word_raw_type *words)
+            {
+                split(from_value(value, value_category()),
+                      words,
+                      std::index_sequence_for<Parts...>());
+            }
+
+            value_type get() const { return decode(words_); }
+
+            void set(const value_type &value) { encode(value, words_); }
+
+            template<size_t Part>
+            word_type_t<Part> word() const
+            {
+                return word_type_t<Part>(words_[Part]);
+            }
+
+            traits::word_raw_type get_raw(size_t part) const { return words_[part]; }
+
+            const traits::word_raw_type *data() const { return words_; }
+
+        private:
+            using value_category = std::integral_constant<
+                int,
+                std::is_floating_point<value_type>::value ? 2 : std::is_signed<value_type>::value>;
+
+            template<size_t... Indices>
+            static uint64_t concatenate(const traits::word_raw_type *words,
+                                        std::index_sequence<Indices...>)
+            {
+                uint64_t bits = 0;
+                const int expand[]{ 0,
+                                    (bits = (bits << part_field_t<Indices>::width()) |
+                                            part_field_t<Indices>::extract(words[Indices]),
+                                     0)... };
+                (void)expand;
+                return bits;
+            }
+
+            template<size_t... Indices>
+            static void split(uint64_t bits,
+                              traits::word_raw_type *words,
+                              std::index_sequence<Indices...>)
+            {
+                // from the least significant part
+                const int expand[]{
+                    0,
+                    (words[parts_count() - 1 - Indices] =
+                         part_field_t<parts_count() - 1 - Indices>::insert(
+                             words[parts_count() - 1 - Indices],
+                             traits::word_raw_type(bits)),
+                     bits >>= part_field_t<parts_count() - 1 - Indices>::width(),
+                     0)...
+                };
+                (void)expand;
+            }
+
+            static int64_t to_signed(uint64_t bits)
+            {
+                constexpr uint64_t sign = uint64_t(1) << (width() - 1);
+                return width() == 64 ? int64_t(bits) : int64_t(bits ^ sign) - int64_t(sign);
+            }
+
+            static value_type to_value(uint64_t bits, std::integral_constant<int, 0> /*unsigned*/)
+            {
+                return value_type(bits);
+            }
+
+            static value_type to_value(uint64_t bits, std::integral_constant<int, 1> /*signed*/)
+            {
+                return value_type(to_signed(bits));
+            }
+
+            static value_type to_value(uint64_t bits,
+                                       std::integral_constant<int, 2> /*floating point*/)
+            {
+                return value_type(to_signed(bits) * (double(ScaleFactorT::num) / ScaleFactorT::den));
+            }
+
+            static uint64_t from_value(const value_type &value,
+                                       std::integral_constant<int, 0> /*unsigned*/)
+            {
+                return uint64_t(value);
+            }
+
+            static uint64_t from_value(const value_type &value,
+                                       std::integral_constant<int, 1> /*signed*/)
+            {
+                return uint64_t(int64_t(value));
+            }
+
+            static uint64_t from_value(const value_type &value,
+                                       std::integral_constant<int, 2> /*floating point*/)
+            {
+                return uint64_t(
+                    int64_t(value / (double(ScaleFactorT::num) / ScaleFactorT::den)));
+            }
+
+            traits::word_raw_type words_[sizeof...(Parts)]{};
+        };
+
+        namespace detail
+        {
+            constexpr uint8_t no_parameter = std::numeric_limits<uint8_t>::max();
+
+            struct fragment_entry
+            {
+                uint8_t parameter;
+                uint8_t part;
+                bool last;
+            };
+
+            /**
+             * Parameter and part of each label.
+             */
+            template<typename... MultiWords>
+            struct fragment_table
+            {
+                constexpr fragment_table()   //
+                  : fragment_table(std::index_sequence_for<MultiWords...>())
+                {
+                }
+
+                template<size_t... Indices>
+                constexpr explicit fragment_table(std::index_sequence<Indices...>)
+                  : entries{},
+                    unique(true)
+                {
+                    for (auto &entry : entries)
+                    {
+                        entry = fragment_entry{ no_parameter, 0, false };
+                    }
+
+                    const int expand[]{ 0, (bind<MultiWords>(uint8_t(Indices)), 0)... };
+                    (void)expand;
+                }
+
+                template<typename MultiWordT>
+                constexpr void bind(uint8_t parameter)
+                {
+                    for (size_t part = 0; part < MultiWordT::parts_count(); ++part)
+                    {
+                        fragment_entry &entry = entries[MultiWordT::label(part)];
+                        unique = unique && entry.parameter == no_parameter;
+                        entry = fragment_entry{ parameter,
+                                                uint8_t(part),
+                                                part + 1 == MultiWordT::parts_count() };
+                    }
+                }
+
+                fragment_entry entries[labels_count];
+                bool unique;
+            };
+        }
+
+        /**
+         * Assembles multi-word parameters from a stream of raw words. A part is looked up by
+         * the label of a word in a 256-entry table and stored in the pending parameter of its
+         * SDI slot. The first part starts a parameter, a part received out of order discards
+         * it. A complete parameter is passed to a handler.
+         * @tparam SdiSlots 1 for a parameter per label, 4 for a parameter per label and SDI.
+         * @tparam MultiWords multi_word types, with labels unique among all their parts.
+         */
+        template<size_t SdiSlots, typename... MultiWords>
+        class basic_multi_word_assembler
+        {
+            static_assert(SdiSlots == 1 || SdiSlots == detail::sdi_count,
+                          "There must be a slot per label or per label and SDI!");
+            static_assert(sizeof...(MultiWords) > 0 &&
+                              sizeof...(MultiWords) < detail::no_parameter,
+                          "Unexpected number of parameters!");
+
+            static constexpr size_t max_parts_ = std::max({ MultiWords::parts_count()... });
+
+        public:
+            /**
+             * Process a raw word.
+             * @param handler callable accepting each of the multi_word types.
+             * @return true if the word completed a parameter.
+             */
+            template<typename Handler>
+            bool push(traits::word_raw_type wordRaw, Handler &&handler)
+            {
+                using handler_t = std::remove_reference_t<Handler>;
+                using complete_t = void (*)(handler_t &, const traits::word_raw_type *);
+                static constexpr complete_t completes[]{ &complete<handler_t, MultiWords>... };
+
+                const detail::fragment_entry &entry =
+                    table().entries[detail::label_field_t::extract(wordRaw)];
+                if (entry.parameter == detail::no_parameter)
+                {
+                    return false;
+                }
+
+                const size_t sdi = detail::sdi_field_t::extract(wordRaw) & (SdiSlots - 1);
+                pending_parameter &pending = pending_[entry.parameter][sdi];
+                if (entry.part != pending.received)
+                {
+                    // the first part restarts a parameter, others are out of order
+                    pending.received = 0;
+                    if (entry.part != 0)
+                    {
+                        return false;
+                    }
+                }
+
+                pending.words[entry.part] = wordRaw;
+                ++pending.received;
+                if (!entry.last)
+                {
+                    return false;
+                }
+
+                pending.received = 0;
+                completes[entry.parameter](handler, pending.words);
+                return true;
+            }
+
+            /**
+             * Process n raw words in order.
+             * @return number of completed parameters.
+             */
+            template<typename Handler>
+            size_t push(const traits::word_raw_type *in, size_t n, Handler &&handler)
+            {
+                size_t completed = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    completed += push(in[i], handler);
+                }
+                return completed;
+            }
+
+            /**
+             * Discard all pending parts.
+             */
+            void reset()
+            {
+                for (auto &slots : pending_)
+                {
+                    for (auto &pending : slots)
+                    {
+                        pending.received = 0;
+                    }
+                }
+            }
+
+        private:
+            struct pending_parameter
+            {
+                traits::word_raw_type words[max_parts_];
+                uint8_t received;
+            };
+
+            static const detail::fragment_table<MultiWords...> &table()
+            {
+                static constexpr detail::fragment_table<MultiWords...> fragmentTable{};
+                static_assert(fragmentTable.unique,
+                              "Multiple parts are bound to the same label!");
+                return fragmentTable;
+            }
+
+            template<typename Handler, typename MultiWordT>
+            static void complete(Handler &handler, const traits::word_raw_type *words)
+            {
+                handler(MultiWordT(words));
+            }
+
+            pending_parameter pending_[sizeof...(MultiWords)][SdiSlots]{};
+        };
+
+        /**
+         * Assembler with a pending parameter per label.
+         */
+        template<typename... MultiWords>
+        using multi_word_assembler = basic_multi_word_assembler<1, MultiWords...>;
+
+        /**
+         * Assembler with a pending parameter per label and SDI, for parameters transmitted by
+         * several sources.
+         */
+        template<typename... MultiWords>
+        using sdi_multi_word_assembler =
+            basic_multi_word_assembler<detail::sdi_count, MultiWords...>;
+    }
+}
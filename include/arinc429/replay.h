@@ -0,0 +1,308 @@
+﻿#pragma once
+
+#include "arinc429/batch.h"
+#include "arinc429/capture.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * Parallel decoding of captures.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Decoded data of a captured word.
+         * @tparam WordT word_generic type.
+         * @tparam NameTypes names of the decoded data descriptors of WordT.
+         */
+        template<typename WordT, typename... NameTypes>
+        struct replay_sample
+        {
+            using values_type = std::tuple<
+                traits::value_type_t<traits::get_data_descriptor_t<NameTypes, WordT>>...>;
+
+            uint64_t timestamp;
+            uint16_t channel;
+            values_type values;
+        };
+
+        namespace detail
+        {
+            /**
+             * Chunk indices split between workers. A worker takes chunks from the front of its
+             * own queue and steals from the back of the others when it runs out.
+             */
+            class work_stealing_queues
+            {
+            public:
+                work_stealing_queues(size_t workersCount, size_t chunksCount)
+                  : queues_(workersCount)
+                {
+                    for (size_t worker = 0; worker < workersCount; ++worker)
+                    {
+                        const size_t first = chunksCount * worker / workersCount;
+                        const size_t last = chunksCount * (worker + 1) / workersCount;
+                        for (size_t chunk = first; chunk < last; ++chunk)
+                        {
+                            queues_[worker].chunks.push_back(chunk);
+                        }
+                    }
+                }
+
+                /**
+                 * Take the next chunk for a worker.
+                 * @return false if no chunks are left.
+                 */
+                bool pop(size_t worker, size_t &chunk)
+                {
+                    for (size_t i = 0; i < queues_.size(); ++i)
+                    {
+                        const bool own = i == 0;
+                        auto &queue = queues_[(worker + i) % queues_.size()];
+
+                        std::lock_guard<std::mutex> lock(queue.mutex);
+                        if (queue.chunks.empty())
+                        {
+                            continue;
+                        }
+                        if (own)
+                        {
+                            chunk = queue.chunks.front();
+                            queue.chunks.pop_front();
+                        }
+                        else
+                        {
+                            chunk = queue.chunks.back();
+                            queue.chunks.pop_back();
+                        }
+                        return true;
+                    }
+                    return false;
+                }
+
+            private:
+                struct queue_type
+                {
+                    std::mutex mutex;
+                    std::deque<size_t> chunks;
+                };
+
+                std::vector<queue_type> queues_;
+            };
+
+            template<typename WordT, typename... NameTypes>
+            struct chunk_decoder
+            {
+                using sample_type = replay_sample<WordT, NameTypes...>;
+
+                /**
+                 * Decode records with the label and sort them by timestamp.
+                 */
+                static void decode(capture_view chunk,
+                                   uint8_t label,
+                                   std::vector<sample_type> &out)
+                {
+                    std::vector<traits::word_raw_type> words;
+                    words.reserve(chunk.size());
+                    out.clear();
+                    for (const auto &record : chunk)
+                    {
+                        if (bit_field<1, 8>::extract(record.word) == label)
+                        {
+                            words.push_back(record.word);
+                            out.push_back(sample_type{ record.timestamp, record.channel, {} });
+                        }
+                    }
+
+                    decode_columns(words, out, std::index_sequence_for<NameTypes...>());
+
+                    const auto earlier = [](const sample_type &lhs, const sample_type &rhs) {
+                        return lhs.timestamp < rhs.timestamp;
+                    };
+                    if (!std::is_sorted(out.begin(), out.end(), earlier))
+                    {
+                        std::stable_sort(out.begin(), out.end(), earlier);
+                    }
+                }
+
+                template<size_t... Indices>
+                static void decode_columns(const std::vector<traits::word_raw_type> &words,
+                                           std::vector<sample_type> &samples,
+                                           std::index_sequence<Indices...>)
+                {
+                    const int expand[]{ 0, (decode_column<Indices>(words, samples), 0)... };
+                    (void)expand;
+                }
+
+                template<size_t Index>
+                static void decode_column(const std::vector<traits::word_raw_type> &words,
+                                          std::vector<sample_type> &samples)
+                {
+                    using name_type = std::tuple_element_t<Index, std::tuple<NameTypes...>>;
+                    using descriptor_t = traits::get_data_descriptor_t<name_type, WordT>;
+
+                    std::unique_ptr<traits::value_type_t<descriptor_t>[]> column(
+                        new traits::value_type_t<descriptor_t>[words.size()]);
+                    arinc429::decode_batch<descriptor_t>(words.data(), words.size(), column.get());
+                    for (size_t i = 0; i < samples.size(); ++i)
+                    {
+                        std::get<Index>(samples[i].values) = column[i];
+                    }
+                }
+            };
+
+            /**
+             * Merge sorted chunk results in timestamp order. Samples with equal timestamps keep
+             * the order of chunks.
+             */
+            template<typename SampleT>
+            std::vector<SampleT> merge_by_timestamp(std::vector<std::vector<SampleT>> &chunks)
+            {
+                using cursor_type = std::pair<uint64_t, size_t>;   // timestamp, chunk
+
+                std::vector<SampleT> merged;
+                size_t total = 0;
+                for (const auto &chunk : chunks)
+                {
+                    total += chunk.size();
+                }
+                merged.reserve(total);
+
+                std::vector<size_t> positions(chunks.size(), 0);
+                std::priority_queue<cursor_type, std::vector<cursor_type>, std::greater<>> heads;
+                for (size_t i = 0; i < chunks.size(); ++i)
+                {
+                    if (!chunks[i].empty())
+                    {
+                        heads.emplace(chunks[i].front().timestamp, i);
+                    }
+                }
+
+                while (!heads.empty())
+                {
+                    const size_t chunk = heads.top().second;
+                    heads.pop();
+
+                    auto &samples = chunks[chunk];
+                    size_t &position = positions[chunk];
+                    const uint64_t limit =
+                        heads.empty() ? std::numeric_limits<uint64_t>::max() : heads.top().first;
+                    // move the run of samples that precede all other chunks
+                    do
+                    {
+                        merged.push_back(std::move(samples[position++]));
+                    } while (position != samples.size() && samples[position].timestamp < limit);
+
+                    if (position != samples.size())
+                    {
+                        heads.emplace(samples[position].timestamp, chunk);
+                    }
+                }
+                return merged;
+            }
+        }
+
+        /**
+         * Decodes captures on a pool of threads. Records are split into chunks that are decoded
+         * with decode_batch by workers stealing chunks from each other, results are merged in
+         * timestamp order.
+         */
+        class replay_engine
+        {
+        public:
+            /**
+             * @param threadsCount number of decoding threads, including the calling one. 0 for
+             * the number of hardware threads.
+             * @param chunkSize number of records decoded by a thread at once.
+             */
+            explicit replay_engine(size_t threadsCount = 0, size_t chunkSize = 64 * 1024)
+              : threads_count_(threadsCount ? threadsCount : hardware_threads()),
+                chunk_size_(chunkSize ? chunkSize : 1)
+            {
+            }
+
+            size_t threads_count() const { return threads_count_; }
+
+            /**
+             * Decode data of records with the label.
+             * @tparam WordT word_generic type of the words with the label.
+             * @tparam NameTypes names of the data descriptors of WordT to decode.
+             * @return samples in timestamp order.
+             */
+            template<typename WordT, typename... NameTypes>
+            std::vector<replay_sample<WordT, NameTypes...>> decode(capture_view records,
+                                                                   uint8_t label) const
+            {
+                using decoder_t = detail::chunk_decoder<WordT, NameTypes...>;
+                using sample_t = replay_sample<WordT, NameTypes...>;
+
+                const size_t chunksCount = (records.size() + chunk_size_ - 1) / chunk_size_;
+                const size_t workersCount =
+                    std::max<size_t>(1, std::min(threads_count_, chunksCount));
+                std::vector<std::vector<sample_t>> results(chunksCount);
+                detail::work_stealing_queues queues(workersCount, chunksCount);
+
+                const auto work = [&](size_t worker) {
+                    size_t chunk = 0;
+                    while (queues.pop(worker, chunk))
+                    {
+                        const size_t first = chunk * chunk_size_;
+                        const size_t count = std::min(chunk_size_, records.size() - first);
+                        decoder_t::decode(capture_view(records.begin() + first, count),
+                                          label,
+                                          results[chunk]);
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                workers.reserve(workersCount - 1);
+                for (size_t worker = 1; worker < workersCount; ++worker)
+                {
+                    workers.emplace_back(work, worker);
+                }
+                work(0);
+                for (auto &worker : workers)
+                {
+                    worker.join();
+                }
+
+                return detail::merge_by_timestamp(results);
+            }
+
+            /**
+             * Decode data of records with the label and pass the samples to a handler in
+             * timestamp order.
+             * @param handler callable with signature
+             * void(const replay_sample<WordT, NameTypes...> &).
+             */
+            template<typename WordT, typename... NameTypes, typename HandlerT>
+            void replay(capture_view records, uint8_t label, HandlerT &&handler) const
+            {
+                for (const auto &sample : decode<WordT, NameTypes...>(records, label))
+                {
+                    handler(sample);
+                }
+            }
+
+        private:
+            static size_t hardware_threads()
+            {
+                const unsigned threads = std::thread::hardware_concurrency();
+                return threads ? threads : 1;
+            }
+
+            size_t threads_count_;
+            size_t chunk_size_;
+        };
+    }
+}
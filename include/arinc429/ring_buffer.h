@@ -0,0 +1,261 @@
+﻿#pragma once
+
+#include "arinc429/arinc429.h"
+
+#include <algorithm>
+#include <atomic>
+
+/**
+ * Lock-free single-producer/single-consumer queue of raw words, e.g. from a receive interrupt to
+ * a decoding thread.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        namespace detail
+        {
+            /**
+             * Size used to separate data written by different threads.
+             */
+            constexpr size_t cache_line_size = 64;
+
+            template<typename TimestampT, size_t Capacity>
+            struct timestamp_storage
+            {
+                using value_type = TimestampT;
+
+                value_type *data() { return timestamps; }
+
+                const value_type *data() const { return timestamps; }
+
+                value_type timestamps[Capacity];
+            };
+
+            template<size_t Capacity>
+            struct timestamp_storage<void, Capacity>
+            {
+            };
+
+            /**
+             * Copy n elements into a ring of Capacity elements starting from index.
+             */
+            template<size_t Capacity, typename InT, typename OutT>
+            void copy_to_ring(const InT *in, size_t n, OutT *ring, size_t index)
+            {
+                const size_t offset = index & (Capacity - 1);
+                const size_t first = std::min(n, Capacity - offset);
+                std::copy(in, in + first, ring + offset);
+                std::copy(in + first, in + n, ring);
+            }
+
+            /**
+             * Copy n elements from a ring of Capacity elements starting from index.
+             */
+            template<size_t Capacity, typename InT, typename OutT>
+            void copy_from_ring(const InT *ring, size_t index, size_t n, OutT *out)
+            {
+                const size_t offset = index & (Capacity - 1);
+                const size_t first = std::min(n, Capacity - offset);
+                std::copy(ring + offset, ring + offset + first, out);
+                std::copy(ring, ring + (n - first), out + first);
+            }
+        }
+
+        /**
+         * Bounded lock-free single-producer/single-consumer ring of raw words. Storage is a part
+         * of the object, no memory is allocated. Producer and consumer indices are kept on
+         * separate cache lines.
+         * @tparam Capacity maximum number of words, power of two.
+         * @tparam TimestampT type of per-word timestamps or void for no timestamps.
+         */
+        template<size_t Capacity, typename TimestampT = void>
+        class spsc_ring
+        {
+            static_assert(detail::is_power_of_two(Capacity), "Capacity must be a power of two!");
+
+            static constexpr bool has_timestamps = !std::is_void<TimestampT>::value;
+
+        public:
+            using timestamp_type = TimestampT;
+
+            static constexpr size_t capacity() { return Capacity; }
+
+            /**
+             * Push a single word. Producer only.
+             * @return false if the ring is full.
+             */
+            bool push(traits::word_raw_type word) { return push_n(&word, 1) == 1; }
+
+            /**
+             * Push a single word with its timestamp. Producer only.
+             * @return false if the ring is full.
+             */
+            template<typename T>
+            bool push(traits::word_raw_type word, const T &timestamp)
+            {
+                return push_n(&word, &timestamp, 1) == 1;
+            }
+
+            /**
+             * Push up to n words. Producer only.
+             * @return number of pushed words.
+             */
+            size_t push_n(const traits::word_raw_type *words, size_t n)
+            {
+                static_assert(!has_timestamps, "Timestamps are required!");
+                return push_n(words, n, [](size_t, size_t, size_t) {});
+            }
+
+            /**
+             * Push up to n words with their timestamps. Producer only.
+             * @return number of pushed words.
+             */
+            template<typename T>
+            size_t push_n(const traits::word_raw_type *words, const T *timestamps, size_t n)
+            {
+                static_assert(has_timestamps, "Ring does not store timestamps!");
+                return push_n(words,
+                              n,
+                              [this, timestamps](size_t offset, size_t head, size_t count) {
+                                  detail::copy_to_ring<Capacity>(timestamps + offset,
+                                                                 count,
+                                                                 timestamps_.data(),
+                                                                 head);
+                              });
+            }
+
+            /**
+             * Pop a single word. Consumer only.
+             * @return false if the ring is empty.
+             */
+            bool pop(traits::word_raw_type &word)
+            {
+                static_assert(!has_timestamps, "Timestamps are required!");
+                return pop_n(&word, 1) == 1;
+            }
+
+            /**
+             * Pop a single word with its timestamp. Consumer only.
+             * @return false if the ring is empty.
+             */
+            template<typename T>
+            bool pop(traits::word_raw_type &word, T &timestamp)
+            {
+                return pop_n(&word, &timestamp, 1) == 1;
+            }
+
+            /**
+             * Pop up to n words. Consumer only.
+             * @return number of popped words.
+             */
+            size_t pop_n(traits::word_raw_type *words, size_t n)
+            {
+                static_assert(!has_timestamps, "Timestamps are required!");
+                return consume(n, [&words](const traits::word_raw_type *in, size_t count) {
+                    words = std::copy(in, in + count, words);
+                });
+            }
+
+            /**
+             * Pop up to n words with their timestamps. Consumer only.
+             * @return number of popped words.
+             */
+            template<typename T>
+            size_t pop_n(traits::word_raw_type *words, T *timestamps, size_t n)
+            {
+                static_assert(has_timestamps, "Ring does not store timestamps!");
+
+                const size_t tail = tail_.load(std::memory_order_relaxed);
+                const size_t count = std::min(n, readable(tail, n));
+                detail::copy_from_ring<Capacity>(timestamps_.data(), tail, count, timestamps);
+                detail::copy_from_ring<Capacity>(words_, tail, count, words);
+                tail_.store(tail + count, std::memory_order_release);
+                return count;
+            }
+
+            /**
+             * Pass up to n words to a consumer in place, without copying, and pop them
+             * afterwards. Consumer only. Words are passed as at most two contiguous blocks, so
+             * consumer may be e.g. decode_batch or label_dispatcher::dispatch.
+             * @param consumer callable with signature void(const traits::word_raw_type *, size_t).
+             * @return number of popped words.
+             */
+            template<typename ConsumerT>
+            size_t consume(size_t n, ConsumerT &&consumer)
+            {
+                const size_t tail = tail_.load(std::memory_order_relaxed);
+                const size_t count = std::min(n, readable(tail, n));
+
+                const size_t offset = tail & (Capacity - 1);
+                const size_t first = std::min(count, Capacity - offset);
+                if (first != 0)
+                {
+                    consumer(static_cast<const traits::word_raw_type *>(words_ + offset), first);
+                }
+                if (count != first)
+                {
+                    consumer(static_cast<const traits::word_raw_type *>(words_), count - first);
+                }
+
+                tail_.store(tail + count, std::memory_order_release);
+                return count;
+            }
+
+            /**
+             * Approximate number of stored words. Exact if called by producer or consumer while
+             * the other side is idle.
+             */
+            size_t size() const
+            {
+                // tail first, so that head is not behind it; words pushed after the load of
+                // tail may exceed the capacity
+                const size_t tail = tail_.load(std::memory_order_acquire);
+                const size_t head = head_.load(std::memory_order_acquire);
+                return std::min(head - tail, Capacity);
+            }
+
+            bool empty() const { return size() == 0; }
+
+        private:
+            template<typename CopyTimestampsT>
+            size_t push_n(const traits::word_raw_type *words,
+                          size_t n,
+                          CopyTimestampsT &&copyTimestamps)
+            {
+                const size_t head = head_.load(std::memory_order_relaxed);
+                if (Capacity - (head - cached_tail_) < n)
+                {
+                    cached_tail_ = tail_.load(std::memory_order_acquire);
+                }
+
+                const size_t count = std::min(n, Capacity - (head - cached_tail_));
+                copyTimestamps(size_t(0), head, count);
+                detail::copy_to_ring<Capacity>(words, count, words_, head);
+                head_.store(head + count, std::memory_order_release);
+                return count;
+            }
+
+            size_t readable(size_t tail, size_t n)
+            {
+                if (cached_head_ - tail < n)
+                {
+                    cached_head_ = head_.load(std::memory_order_acquire);
+                }
+                return cached_head_ - tail;
+            }
+
+            // producer
+            alignas(detail::cache_line_size) std::atomic<size_t> head_{ 0 };
+            size_t cached_tail_ = 0;
+
+            // consumer
+            alignas(detail::cache_line_size) std::atomic<size_t> tail_{ 0 };
+            size_t cached_head_ = 0;
+
+            alignas(detail::cache_line_size) traits::word_raw_type words_[Capacity];
+            detail::timestamp_storage<TimestampT, Capacity> timestamps_;
+        };
+    }
+}
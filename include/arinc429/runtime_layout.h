@@ -0,0 +1,174 @@
+﻿#pragma once
+
+#include "arinc429/arinc429.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/**
+ * Words with data described at run time, e.g. loaded from ICD files.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Decoding of a runtime field, same as for value types of data descriptors.
+         */
+        enum class runtime_field_type
+        {
+            unsigned_integral,
+            signed_integral,
+            /**
+             * Signed integral scaled by scale factor.
+             */
+            floating_point
+        };
+
+        struct runtime_field
+        {
+            std::string name;
+            size_t lsb;
+            size_t msb;
+            runtime_field_type type;
+            double scale_factor;
+        };
+
+        /**
+         * Layout of a word described at run time, compiled into a decode plan: an array of
+         * entries with precomputed shift, mask, sign and scale, sorted by bit position.
+         * Decoding matches get_value(T &, traits::word_raw_type, lsb, msb, scaleFactor).
+         * The layout is immutable, so a single instance may be shared between threads.
+         */
+        class runtime_word_layout
+        {
+        public:
+            runtime_word_layout() = default;
+
+            /**
+             * Compile fields. The layout is invalid if a field has an invalid bit range or
+             * overlaps another field.
+             */
+            explicit runtime_word_layout(std::vector<runtime_field> fields)
+              : fields_(std::move(fields))
+            {
+                traits::word_raw_type usedBits = 0;
+                plan_.reserve(fields_.size());
+                for (size_t i = 0; i < fields_.size(); ++i)
+                {
+                    const runtime_field &field = fields_[i];
+                    if (field.lsb < 1 || field.lsb > field.msb || field.msb > traits::word_size)
+                    {
+                        valid_ = false;
+                        continue;
+                    }
+
+                    const size_t width = field.msb - field.lsb + 1;
+                    plan_entry entry{};
+                    entry.shift = uint32_t(field.lsb - 1);
+                    entry.mask = std::numeric_limits<traits::word_raw_type>::max() >>
+                                 (traits::word_size - width);
+                    entry.sign = field.type == runtime_field_type::unsigned_integral
+                                     ? 0
+                                     : traits::word_raw_type(1) << (width - 1);
+                    entry.scale =
+                        field.type == runtime_field_type::floating_point ? field.scale_factor : 1.0;
+                    entry.index = uint32_t(i);
+
+                    valid_ = valid_ && (usedBits & (entry.mask << entry.shift)) == 0;
+                    usedBits |= entry.mask << entry.shift;
+                    plan_.push_back(entry);
+                }
+
+                std::sort(plan_.begin(),
+                          plan_.end(),
+                          [](const plan_entry &lhs, const plan_entry &rhs) {
+                              return lhs.shift < rhs.shift;
+                          });
+            }
+
+            bool valid() const { return valid_; }
+
+            const std::vector<runtime_field> &fields() const { return fields_; }
+
+            size_t size() const { return fields_.size(); }
+
+            /**
+             * Find index of a field by name.
+             * @return size() if there is no field with the name.
+             */
+            size_t find(const std::string &name) const
+            {
+                return size_t(std::find_if(fields_.begin(),
+                                           fields_.end(),
+                                           [&name](const runtime_field &field) {
+                                               return field.name == name;
+                                           }) -
+                              fields_.begin());
+            }
+
+            /**
+             * Decode all fields of a raw word.
+             * @param values buffer of size() values in order of fields.
+             */
+            void decode(traits::word_raw_type wordRaw, double *values) const
+            {
+                for (const plan_entry &entry : plan_)
+                {
+                    values[entry.index] = decode(entry, wordRaw);
+                }
+            }
+
+            /**
+             * Decode all fields of n raw words, row by row.
+             * @param out buffer of n * size() values.
+             */
+            void decode_batch(const traits::word_raw_type *in, size_t n, double *out) const
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    decode(in[i], out + i * fields_.size());
+                }
+            }
+
+            /**
+             * Decode all fields of n raw words in structure-of-arrays layout.
+             * @param columns size() buffers of n values, in order of fields.
+             */
+            void decode_soa(const traits::word_raw_type *in, size_t n, double *const *columns) const
+            {
+                for (const plan_entry &entry : plan_)
+                {
+                    double *column = columns[entry.index];
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        column[i] = decode(entry, in[i]);
+                    }
+                }
+            }
+
+        private:
+            struct plan_entry
+            {
+                traits::word_raw_type mask;
+                traits::word_raw_type sign;
+                uint32_t shift;
+                uint32_t index;
+                double scale;
+            };
+
+            static double decode(const plan_entry &entry, traits::word_raw_type wordRaw)
+            {
+                const traits::word_raw_type bits = (wordRaw >> entry.shift) & entry.mask;
+                // sign is 0 for unsigned fields
+                return double(int64_t(bits ^ entry.sign) - int64_t(entry.sign)) * entry.scale;
+            }
+
+            std::vector<runtime_field> fields_;
+            std::vector<plan_entry> plan_;
+            bool valid_ = true;
+        };
+    }
+}
@@ -0,0 +1,309 @@
+﻿#pragma once
+
+#include "arinc429/dispatch.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/**
+ * Detection of labels that miss their expected transmit interval.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Binds a word type to its label and the number of ticks after the last word when the
+         * label becomes stale.
+         * @tparam Label label octet as stored in bits 1-8 of a raw word.
+         * @tparam WordT word_generic type.
+         * @tparam Timeout expected transmit interval with a tolerance, in ticks, not 0.
+         */
+        template<uint8_t Label, typename WordT, uint64_t Timeout>
+        struct label_rate : label_word<Label, WordT>
+        {
+            static_assert(Timeout != 0, "Timeout must not be 0!");
+
+            static constexpr uint64_t timeout() { return Timeout; }
+        };
+
+        /**
+         * Transition of a label of a channel, passed to handlers of staleness_monitor.
+         */
+        struct staleness_event
+        {
+            uint64_t time;
+            uint16_t channel;
+            uint8_t label;
+            /**
+             * true if the label became stale, false if a word was received after that.
+             */
+            bool stale;
+        };
+
+        namespace detail
+        {
+            /**
+             * Hierarchical timing wheel: each level has 64 slots, a slot of level L spans
+             * 64^L ticks. Timers are scheduled at the level that fits their deadline and move
+             * to lower levels as time advances, so a tick only visits the timers that expire or
+             * cascade at it. Deadlines beyond the top level are rescheduled when it wraps.
+             */
+            class timing_wheel
+            {
+                static constexpr size_t slot_bits = 6;
+                static constexpr size_t slots_count = size_t(1) << slot_bits;
+                static constexpr size_t levels_count = 4;
+
+            public:
+                struct timer
+                {
+                    uint32_t index;
+                    uint64_t deadline;
+                };
+
+                explicit timing_wheel(uint64_t now)
+                  : now_(now)
+                {
+                }
+
+                uint64_t now() const { return now_; }
+
+                /**
+                 * @param deadline time after now().
+                 */
+                void schedule(uint32_t index, uint64_t deadline)
+                {
+                    constexpr uint64_t span = uint64_t(1) << (slot_bits * levels_count);
+                    const uint64_t at = deadline - now_ < span ? deadline : now_ + span - 1;
+
+                    size_t level = 0;
+                    while (level + 1 < levels_count &&
+                           at - now_ >= uint64_t(1) << (slot_bits * (level + 1)))
+                    {
+                        ++level;
+                    }
+                    slots_[level][(at >> (slot_bits * level)) & (slots_count - 1)].push_back(
+                        timer{ index, deadline });
+                    ++sizes_[level];
+                }
+
+                /**
+                 * Advance to time, calling expired with each timer whose deadline is reached.
+                 * @param expired callable with signature void(const timer &), may schedule
+                 * timers.
+                 */
+                template<typename ExpiredT>
+                void advance(uint64_t time, ExpiredT &&expired)
+                {
+                    while (now_ < time)
+                    {
+                        // skip the ticks before the next cascade of the lowest non-empty level
+                        size_t lowest = 0;
+                        while (lowest < levels_count && sizes_[lowest] == 0)
+                        {
+                            ++lowest;
+                        }
+                        if (lowest == levels_count)
+                        {
+                            now_ = time;
+                            break;
+                        }
+                        if (lowest > 0)
+                        {
+                            const uint64_t period = uint64_t(1) << (slot_bits * lowest);
+                            now_ = std::min(time - 1, now_ | (period - 1));
+                        }
+
+                        ++now_;
+                        for (size_t level = levels_count - 1; level > 0; --level)
+                        {
+                            if ((now_ & ((uint64_t(1) << (slot_bits * level)) - 1)) == 0)
+                            {
+                                cascade(level);
+                            }
+                        }
+
+                        visited_.clear();
+                        visited_.swap(slots_[0][now_ & (slots_count - 1)]);
+                        sizes_[0] -= visited_.size();
+                        for (const timer &expiredTimer : visited_)
+                        {
+                            expired(expiredTimer);
+                        }
+                    }
+                }
+
+            private:
+                void cascade(size_t level)
+                {
+                    visited_.clear();
+                    visited_.swap(
+                        slots_[level][(now_ >> (slot_bits * level)) & (slots_count - 1)]);
+                    sizes_[level] -= visited_.size();
+                    for (const timer &cascaded : visited_)
+                    {
+                        schedule(cascaded.index, cascaded.deadline);
+                    }
+                }
+
+                uint64_t now_;
+                std::vector<timer> slots_[levels_count][slots_count];
+                /**
+                 * Number of timers at each level.
+                 */
+                size_t sizes_[levels_count]{};
+                std::vector<timer> visited_;
+            };
+
+            template<typename... LabelRates>
+            struct label_timeouts
+            {
+                constexpr label_timeouts()   //
+                  : timeouts{}
+                {
+                    const int expand[]{ 0,
+                                        (timeouts[LabelRates::label()] = LabelRates::timeout(),
+                                         0)... };
+                    (void)expand;
+                }
+
+                /**
+                 * 0 for labels that are not monitored.
+                 */
+                uint64_t timeouts[labels_count];
+            };
+        }
+
+        /**
+         * Monitors bound labels on each channel and reports the labels that receive no words
+         * for their timeout. A received word only updates the deadline of its label, the
+         * timer is in a timing wheel and is rescheduled to the updated deadline when it
+         * expires. Handlers are called only on transitions between fresh and stale.
+         * Time is measured in ticks, e.g. milliseconds. Labels are fresh when monitoring starts.
+         * @tparam LabelRates label_rate bindings.
+         */
+        template<typename... LabelRates>
+        class staleness_monitor
+        {
+            static_assert(detail::are_unique(LabelRates::label()...),
+                          "Multiple word types are bound to the same label!");
+
+        public:
+            /**
+             * @param channelsCount number of monitored channels.
+             * @param now current tick.
+             */
+            explicit staleness_monitor(uint16_t channelsCount, uint64_t now = 0)
+              : wheel_(now),
+                indices_(size_t(channelsCount) * detail::labels_count, no_entry)
+            {
+                const uint8_t labels[]{ LabelRates::label()... };
+                entries_.reserve(size_t(channelsCount) * sizeof...(LabelRates));
+                for (uint16_t channel = 0; channel < channelsCount; ++channel)
+                {
+                    for (const uint8_t label : labels)
+                    {
+                        const auto index = uint32_t(entries_.size());
+                        const uint64_t timeout = timeouts_.timeouts[label];
+                        entries_.push_back(entry{ now + timeout, timeout, channel, label, false });
+                        indices_[slot_index(channel, label)] = index;
+                        wheel_.schedule(index, now + timeout);
+                    }
+                }
+            }
+
+            uint64_t now() const { return wheel_.now(); }
+
+            size_t channels_count() const { return indices_.size() / detail::labels_count; }
+
+            /**
+             * @return false if the label is fresh or not monitored.
+             */
+            bool is_stale(uint16_t channel, uint8_t label) const
+            {
+                const uint32_t index = indices_[slot_index(channel, label)];
+                return index != no_entry && entries_[index].stale;
+            }
+
+            /**
+             * Register a word received on a channel at the current tick.
+             * @param handler callable with signature void(const staleness_event &), called if
+             * the label was stale.
+             * @return false if the label is not monitored.
+             */
+            template<typename Handler>
+            bool received(uint16_t channel, traits::word_raw_type wordRaw, Handler &&handler)
+            {
+                const uint32_t index =
+                    indices_[slot_index(channel, uint8_t(detail::label_field_t::extract(wordRaw)))];
+                if (index == no_entry)
+                {
+                    return false;
+                }
+
+                entry &received = entries_[index];
+                received.deadline = wheel_.now() + received.timeout;
+                if (received.stale)
+                {
+                    received.stale = false;
+                    wheel_.schedule(index, received.deadline);
+                    handler(staleness_event{ wheel_.now(), channel, received.label, false });
+                }
+                return true;
+            }
+
+            /**
+             * Advance to a later tick.
+             * @param handler callable with signature void(const staleness_event &), called for
+             * each label that became stale, in order of ticks.
+             */
+            template<typename Handler>
+            void advance(uint64_t time, Handler &&handler)
+            {
+                wheel_.advance(time, [this, &handler](const detail::timing_wheel::timer &timer) {
+                    entry &expired = entries_[timer.index];
+                    if (expired.deadline > wheel_.now())
+                    {
+                        wheel_.schedule(timer.index, expired.deadline);
+                        return;
+                    }
+
+                    expired.stale = true;
+                    handler(staleness_event{ wheel_.now(), expired.channel, expired.label, true });
+                });
+            }
+
+        private:
+            static constexpr uint32_t no_entry = std::numeric_limits<uint32_t>::max();
+
+            struct entry
+            {
+                uint64_t deadline;
+                uint64_t timeout;
+                uint16_t channel;
+                uint8_t label;
+                bool stale;
+            };
+
+            static size_t slot_index(uint16_t channel, uint8_t label)
+            {
+                return size_t(channel) * detail::labels_count + label;
+            }
+
+            static constexpr detail::label_timeouts<LabelRates...> timeouts_{};
+
+            detail::timing_wheel wheel_;
+            std::vector<entry> entries_;
+            std::vector<uint32_t> indices_;
+        };
+
+        template<typename... LabelRates>
+        constexpr detail::label_timeouts<LabelRates...> staleness_monitor<LabelRates...>::timeouts_;
+
+        template<typename... LabelRates>
+        constexpr uint32_t staleness_monitor<LabelRates...>::no_entry;
+    }
+}
@@ -0,0 +1,171 @@
+﻿#pragma once
+
+#include "arinc429/arinc429.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Periodic transmission of words.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Handle of a word registered in a transmit_scheduler.
+         * @tparam WordT word_generic type of the word.
+         */
+        template<typename WordT>
+        struct transmit_slot
+        {
+            using word_type = WordT;
+
+            size_t index;
+        };
+
+        /**
+         * Words due at a tick, in the order of their registration.
+         */
+        class transmit_frame
+        {
+        public:
+            constexpr transmit_frame(const traits::word_raw_type *words, size_t count)
+              : words_(words),
+                count_(count)
+            {
+            }
+
+            const traits::word_raw_type *data() const { return words_; }
+
+            const traits::word_raw_type *begin() const { return words_; }
+
+            const traits::word_raw_type *end() const { return words_ + count_; }
+
+            size_t size() const { return count_; }
+
+            bool empty() const { return count_ == 0; }
+
+        private:
+            const traits::word_raw_type *words_;
+            size_t count_;
+        };
+
+        /**
+         * Keeps encoded words and transmits each of them with its period. Updating data of a
+         * word re-encodes only the bits of its data descriptor. Due times are kept in a timing
+         * wheel, so a tick only visits the words due at it and a bucket of the wheel.
+         * Periods longer than the wheel are supported at the cost of extra visits.
+         * @tparam WheelSize number of buckets of the timing wheel, power of two.
+         */
+        template<size_t WheelSize = 64>
+        class transmit_scheduler
+        {
+            static_assert(detail::is_power_of_two(WheelSize), "Wheel size must be a power of two!");
+
+        public:
+            /**
+             * Register a word.
+             * @param word initial word.
+             * @param period number of ticks between transmissions, not 0.
+             * @param phase number of ticks from the current tick to the first transmission, so
+             * that words with equal periods may be spread between ticks.
+             * @return handle to update data of the word.
+             */
+            template<typename WordT>
+            transmit_slot<WordT> add(const WordT &word, uint64_t period, uint64_t phase = 0)
+            {
+                assert(period != 0 && "Period must not be 0!");
+
+                const size_t index = slots_.size();
+                slots_.push_back(slot_state{ word.get_raw(), period ? period : 1, now_ + phase });
+                schedule(index);
+                return transmit_slot<WordT>{ index };
+            }
+
+            /**
+             * Encode a value into the data with NameType of a registered word.
+             */
+            template<typename NameType, typename WordT, typename T>
+            void set(transmit_slot<WordT> slot, const T &value)
+            {
+                using descriptor_t = traits::get_data_descriptor_t<NameType, WordT>;
+                using value_type = traits::value_type_t<descriptor_t>;
+
+                traits::word_raw_type &wordRaw = slots_[slot.index].word;
+                wordRaw = (wordRaw & ~detail::descriptor_bit_field_t<descriptor_t>::mask()) |
+                          detail::encode_value<descriptor_t>(value_type(value));
+            }
+
+            /**
+             * Replace a registered word.
+             */
+            template<typename WordT>
+            void set_word(transmit_slot<WordT> slot, const WordT &word)
+            {
+                slots_[slot.index].word = word.get_raw();
+            }
+
+            template<typename WordT>
+            WordT word(transmit_slot<WordT> slot) const
+            {
+                return WordT(slots_[slot.index].word);
+            }
+
+            /**
+             * Current tick.
+             */
+            uint64_t now() const { return now_; }
+
+            /**
+             * Collect the words due at the current tick and advance to the next tick.
+             * @return frame that stays valid until the next call.
+             */
+            transmit_frame tick()
+            {
+                frame_.clear();
+                visited_.clear();
+                visited_.swap(wheel_[now_ & (WheelSize - 1)]);
+
+                // visited_ is in the order of scheduling, sort by registration
+                std::sort(visited_.begin(), visited_.end());
+                for (const size_t index : visited_)
+                {
+                    slot_state &slot = slots_[index];
+                    if (slot.due != now_)
+                    {
+                        wheel_[now_ & (WheelSize - 1)].push_back(index);
+                        continue;
+                    }
+
+                    frame_.push_back(slot.word);
+                    slot.due += slot.period;
+                    schedule(index);
+                }
+
+                ++now_;
+                return transmit_frame(frame_.data(), frame_.size());
+            }
+
+        private:
+            struct slot_state
+            {
+                traits::word_raw_type word;
+                uint64_t period;
+                uint64_t due;
+            };
+
+            void schedule(size_t index)
+            {
+                wheel_[slots_[index].due & (WheelSize - 1)].push_back(index);
+            }
+
+            std::vector<slot_state> slots_;
+            std::vector<size_t> wheel_[WheelSize];
+            std::vector<size_t> visited_;
+            std::vector<traits::word_raw_type> frame_;
+            uint64_t now_ = 0;
+        };
+    }
+}
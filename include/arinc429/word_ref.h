@@ -0,0 +1,152 @@
+﻿#pragma once
+
+#include "arinc429/arinc429.h"
+
+/**
+ * Non-owning access to raw words stored elsewhere: in memory, in hardware registers or in byte
+ * buffers of a given endianness.
+ */
+
+namespace eld
+{
+    namespace arinc429
+    {
+        /**
+         * Storage of a raw word in native representation.
+         * @tparam T cv-qualified traits::word_raw_type.
+         */
+        template<typename T = traits::word_raw_type>
+        struct native_storage
+        {
+            static_assert(std::is_same<std::remove_cv_t<T>, traits::word_raw_type>(),
+                          "Native storage must be a raw word!");
+
+            using pointer = T *;
+
+            static traits::word_raw_type load(pointer storage) { return *storage; }
+
+            static void store(pointer storage, traits::word_raw_type wordRaw)
+            {
+                *storage = wordRaw;
+            }
+        };
+
+        /**
+         * Storage of a raw word as 4 bytes, most significant byte first.
+         * @tparam ByteT cv-qualified byte type.
+         */
+        template<typename ByteT = uint8_t>
+        struct big_endian_storage
+        {
+            static_assert(sizeof(ByteT) == 1, "Storage must be a byte buffer!");
+
+            using pointer = ByteT *;
+
+            static traits::word_raw_type load(pointer storage)
+            {
+                return traits::word_raw_type(uint8_t(storage[0])) << 24 |
+                       traits::word_raw_type(uint8_t(storage[1])) << 16 |
+                       traits::word_raw_type(uint8_t(storage[2])) << 8 |
+                       traits::word_raw_type(uint8_t(storage[3]));
+            }
+
+            static void store(pointer storage, traits::word_raw_type wordRaw)
+            {
+                storage[0] = ByteT(wordRaw >> 24);
+                storage[1] = ByteT(wordRaw >> 16);
+                storage[2] = ByteT(wordRaw >> 8);
+                storage[3] = ByteT(wordRaw);
+            }
+        };
+
+        /**
+         * Storage of a raw word as 4 bytes, least significant byte first.
+         * @tparam ByteT cv-qualified byte type.
+         */
+        template<typename ByteT = uint8_t>
+        struct little_endian_storage
+        {
+            static_assert(sizeof(ByteT) == 1, "Storage must be a byte buffer!");
+
+            using pointer = ByteT *;
+
+            static traits::word_raw_type load(pointer storage)
+            {
+                return traits::word_raw_type(uint8_t(storage[0])) |
+                       traits::word_raw_type(uint8_t(storage[1])) << 8 |
+                       traits::word_raw_type(uint8_t(storage[2])) << 16 |
+                       traits::word_raw_type(uint8_t(storage[3])) << 24;
+            }
+
+            static void store(pointer storage, traits::word_raw_type wordRaw)
+            {
+                storage[0] = ByteT(wordRaw);
+                storage[1] = ByteT(wordRaw >> 8);
+                storage[2] = ByteT(wordRaw >> 16);
+                storage[3] = ByteT(wordRaw >> 24);
+            }
+        };
+
+        /**
+         * Reference to a raw word in external storage, with the same data access API as WordT.
+         * Each get loads the raw word once, each set loads and stores it once.
+         * @tparam WordT word_generic type.
+         * @tparam StorageT storage policy: native_storage, big_endian_storage or
+         * little_endian_storage.
+         */
+        template<typename WordT, typename StorageT = native_storage<>>
+        class word_ref
+        {
+        public:
+            using word_type = WordT;
+            using storage_type = StorageT;
+            using pointer = typename storage_type::pointer;
+            using tuple_descriptors = typename traits::word_traits<WordT>::tuple_descriptors;
+
+            constexpr explicit word_ref(pointer storage)   //
+              : storage_(storage)
+            {
+            }
+
+            template<typename NameType>
+            auto get() const
+            {
+                return word().template get<NameType>();
+            }
+
+            template<typename NameType, typename T>
+            void set(const T &value)
+            {
+                word_type wordCopy = word();
+                wordCopy.template set<NameType>(value);
+                set_raw(wordCopy.get_raw());
+            }
+
+            /**
+             * Load the referenced word.
+             */
+            word_type word() const { return word_type(get_raw()); }
+
+            traits::word_raw_type get_raw() const { return storage_type::load(storage_); }
+
+            void set_raw(traits::word_raw_type rawWord) { storage_type::store(storage_, rawWord); }
+
+            pointer storage() const { return storage_; }
+
+        private:
+            pointer storage_;
+        };
+
+        /**
+         * Read-only reference to a raw word in memory.
+         */
+        template<typename WordT>
+        using word_view = word_ref<WordT, native_storage<const traits::word_raw_type>>;
+
+        /**
+         * Reference to a raw word in a hardware register.
+         */
+        template<typename WordT>
+        using volatile_word_ref = word_ref<WordT, native_storage<volatile traits::word_raw_type>>;
+    }
+}
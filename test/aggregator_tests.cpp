@@ -0,0 +1,200 @@
+
+#include "arinc429/aggregator.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, int32_t>
+    {
+    };
+
+    using data_word_t = eld::arinc429::word_generic<label, data>;
+
+    using aggregator_t =
+        eld::arinc429::channel_aggregator<256,
+                                          eld::arinc429::label_word<0312, data_word_t>,
+                                          eld::arinc429::label_word<0162, data_word_t>>;
+
+    eld::arinc429::traits::word_raw_type make_word(uint8_t labelValue, int32_t dataValue)
+    {
+        data_word_t word{ 0 };
+        word.set<label>(labelValue);
+        word.set<data>(dataValue);
+        return word.get_raw();
+    }
+
+    struct counting_handler
+    {
+        void operator()(uint16_t channel, data_word_t word)
+        {
+            ++counts[channel];
+            sums[channel] += word.get<data>();
+        }
+
+        std::vector<size_t> counts;
+        std::vector<int64_t> sums;
+    };
+}
+
+TEST(ChannelAggregatorTests, RoundRobinWorkers)
+{
+    EXPECT_EQ((std::vector<size_t>{ 0, 1, 2, 0, 1 }), eld::arinc429::round_robin_workers(5, 3));
+}
+
+TEST(ChannelAggregatorTests, AlignedChannels)
+{
+    auto aggregator = std::make_unique<aggregator_t>(std::vector<size_t>{ 0, 1, 0, 1, 0 });
+    for (size_t channel = 0; channel < aggregator->channels_count(); ++channel)
+    {
+        EXPECT_EQ(0u,
+                  reinterpret_cast<uintptr_t>(&aggregator->ring(channel)) %
+                      alignof(aggregator_t::ring_type));
+    }
+}
+
+TEST(ChannelAggregatorTests, PollOwnChannels)
+{
+    auto aggregator = std::make_unique<aggregator_t>(std::vector<size_t>{ 0, 1, 0 });
+    EXPECT_EQ(3u, aggregator->channels_count());
+    EXPECT_EQ(2u, aggregator->workers_count());
+
+    aggregator->ring(0).push(make_word(0312, 5));
+    aggregator->ring(1).push(make_word(0312, 6));
+    aggregator->ring(2).push(make_word(0162, 7));
+    aggregator->ring(2).push(make_word(0100, 8));
+
+    counting_handler handler{ std::vector<size_t>(3), std::vector<int64_t>(3) };
+    EXPECT_EQ(3u, aggregator->poll(0, handler));
+    EXPECT_EQ((std::vector<size_t>{ 1, 0, 1 }), handler.counts);
+    EXPECT_EQ((std::vector<int64_t>{ 5, 0, 7 }), handler.sums);
+    EXPECT_EQ(1u, aggregator->ring(1).size());
+
+    data_word_t word{ 0 };
+    ASSERT_TRUE(aggregator->cache(0).get<0312>(word));
+    EXPECT_EQ(5, word.get<data>());
+    EXPECT_FALSE(aggregator->cache(1).get<0312>(word));
+    ASSERT_TRUE(aggregator->cache(2).get<0162>(word));
+    EXPECT_EQ(7, word.get<data>());
+
+    EXPECT_EQ(1u, aggregator->poll(1));
+    ASSERT_TRUE(aggregator->cache(1).get<0312>(word));
+    EXPECT_EQ(6, word.get<data>());
+}
+
+TEST(ChannelAggregatorTests, StealOnlyAboveThreshold)
+{
+    auto aggregator = std::make_unique<aggregator_t>(std::vector<size_t>{ 0, 1 }, 4);
+
+    for (int32_t i = 0; i < 3; ++i)
+    {
+        aggregator->ring(0).push(make_word(0312, i));
+    }
+    EXPECT_EQ(0u, aggregator->poll(1));
+    EXPECT_EQ(3u, aggregator->ring(0).size());
+
+    aggregator->ring(0).push(make_word(0312, 3));
+    counting_handler handler{ std::vector<size_t>(2), std::vector<int64_t>(2) };
+    EXPECT_EQ(4u, aggregator->poll(1, handler));
+    EXPECT_EQ((std::vector<size_t>{ 4, 0 }), handler.counts);
+
+    data_word_t word{ 0 };
+    ASSERT_TRUE(aggregator->cache(0).get<0312>(word));
+    EXPECT_EQ(3, word.get<data>());
+
+    // a worker with words of its own does not steal
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        aggregator->ring(0).push(make_word(0312, i));
+    }
+    aggregator->ring(1).push(make_word(0312, 9));
+    EXPECT_EQ(1u, aggregator->poll(1));
+    EXPECT_EQ(4u, aggregator->ring(0).size());
+}
+
+TEST(ChannelAggregatorTests, Snapshot)
+{
+    auto aggregator = std::make_unique<aggregator_t>(eld::arinc429::round_robin_workers(2, 1));
+    aggregator->ring(0).push(make_word(0312, 1));
+    aggregator->ring(1).push(make_word(0162, 2));
+    aggregator->poll(0);
+
+    std::vector<aggregator_t::cache_snapshot_type> snapshot;
+    aggregator->snapshot(snapshot);
+    ASSERT_EQ(2u, snapshot.size());
+    EXPECT_EQ(make_word(0312, 1), snapshot[0].words[0312]);
+    EXPECT_EQ(1u, (snapshot[0].received[0312 / 64] >> (0312 % 64)) & 1u);
+    EXPECT_EQ(0u, (snapshot[0].received[0162 / 64] >> (0162 % 64)) & 1u);
+    EXPECT_EQ(make_word(0162, 2), snapshot[1].words[0162]);
+}
+
+TEST(ChannelAggregatorTests, ConcurrentWorkers)
+{
+    constexpr size_t channelsCount = 4;
+    constexpr int32_t wordsCount = 20000;
+
+    auto aggregator = std::make_unique<aggregator_t>(
+        eld::arinc429::round_robin_workers(channelsCount, 2), 64);
+
+    std::vector<std::thread> producers;
+    for (size_t channel = 0; channel < channelsCount; ++channel)
+    {
+        producers.emplace_back([&aggregator, channel] {
+            for (int32_t i = 0; i < wordsCount; ++i)
+            {
+                while (!aggregator->ring(channel).push(make_word(0312, i)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::atomic<bool> stop{ false };
+    std::vector<std::vector<int32_t>> last(2, std::vector<int32_t>(channelsCount, -1));
+    std::vector<size_t> outOfOrder(2);
+    std::vector<std::thread> workers;
+    for (size_t worker = 0; worker < 2; ++worker)
+    {
+        workers.emplace_back([&, worker] {
+            aggregator->run(worker, stop, [&](uint16_t channel, data_word_t word) {
+                const int32_t value = word.get<data>();
+                outOfOrder[worker] += value <= last[worker][channel];
+                last[worker][channel] = value;
+            });
+        });
+    }
+
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+    for (size_t channel = 0; channel < channelsCount; ++channel)
+    {
+        while (!aggregator->ring(channel).empty())
+        {
+            std::this_thread::yield();
+        }
+    }
+    stop.store(true);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    EXPECT_EQ(0u, outOfOrder[0] + outOfOrder[1]);
+    for (size_t channel = 0; channel < channelsCount; ++channel)
+    {
+        EXPECT_EQ(wordsCount - 1, std::max(last[0][channel], last[1][channel]));
+        data_word_t word{ 0 };
+        ASSERT_TRUE(aggregator->cache(channel).get<0312>(word));
+        EXPECT_EQ(wordsCount - 1, word.get<data>());
+    }
+}
@@ -0,0 +1,354 @@
+
+#include "arinc429/batch.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    std::vector<eld::arinc429::traits::word_raw_type> make_raw_words(size_t count)
+    {
+        std::vector<eld::arinc429::traits::word_raw_type> rawWords(count);
+
+        eld::arinc429::traits::word_raw_type state = 0xf3f21872;
+        for (auto &rawWord : rawWords)
+        {
+            // xorshift32
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            rawWord = state;
+        }
+        return rawWords;
+    }
+
+    template<typename DataDescriptor>
+    void expect_batch_same_as_word()
+    {
+        using name_t = eld::arinc429::traits::name_type_t<DataDescriptor>;
+        using value_t = eld::arinc429::traits::value_type_t<DataDescriptor>;
+        using word_t = eld::arinc429::word_generic<DataDescriptor>;
+
+        // not a multiple of any vector width to cover the scalar tail
+        const auto rawWords = make_raw_words(37);
+
+        std::vector<value_t> values(rawWords.size());
+        eld::arinc429::decode_batch<DataDescriptor>(rawWords.data(),
+                                                    rawWords.size(),
+                                                    values.data());
+
+        std::vector<eld::arinc429::traits::word_raw_type> encoded(make_raw_words(41));
+        eld::arinc429::encode_batch<DataDescriptor>(values.data(), values.size(), encoded.data());
+
+        const auto original = make_raw_words(41);
+        for (size_t i = 0; i < rawWords.size(); ++i)
+        {
+            word_t word{ rawWords[i] };
+            EXPECT_EQ(word.template get<name_t>(), values[i]) << "index " << i;
+
+            word_t expectedWord{ original[i] };
+            expectedWord.template set<name_t>(values[i]);
+            EXPECT_EQ(expectedWord.get_raw(), encoded[i]) << "index " << i;
+        }
+
+        for (size_t i = rawWords.size(); i < encoded.size(); ++i)
+        {
+            EXPECT_EQ(original[i], encoded[i]) << "index " << i;
+        }
+    }
+}
+
+TEST(BatchTests, UnsignedInHead)
+{
+    struct data : eld::arinc429::data_descriptor<data, 1, 8, uint32_t>
+    {
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, UnsignedInCenter)
+{
+    struct data : eld::arinc429::data_descriptor<data, 11, 20, uint32_t>
+    {
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, UnsignedInTail)
+{
+    struct data : eld::arinc429::data_descriptor<data, 21, 32, uint32_t>
+    {
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, SignedInHead)
+{
+    struct data : eld::arinc429::data_descriptor<data, 1, 10, int32_t>
+    {
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, SignedInCenter)
+{
+    struct data : eld::arinc429::data_descriptor<data, 9, 29, int32_t>
+    {
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, SignedFullCapacity)
+{
+    struct data : eld::arinc429::data_descriptor<data, 1, 32, int32_t>
+    {
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, NarrowValueType)
+{
+    struct data : eld::arinc429::data_descriptor<data, 30, 31, uint8_t>
+    {
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, Double)
+{
+    struct data : eld::arinc429::data_descriptor<data, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, CustomizedGetterAndSetter)
+{
+    struct data : eld::arinc429::data_descriptor<data, 9, 29, uint32_t>
+    {
+        void operator()(value_type value,
+                        eld::arinc429::traits::word_raw_type &raw_word,
+                        eld::arinc429::tag_set)
+        {
+            eld::arinc429::detail::set_value<data>(value / 2, raw_word, std::false_type{});
+        }
+
+        void operator()(value_type &dest,
+                        eld::arinc429::traits::word_raw_type raw_word,
+                        eld::arinc429::tag_get)
+        {
+            eld::arinc429::detail::get_value<data>(dest, raw_word, std::false_type{});
+            dest *= 2;
+        }
+    };
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, StructureOfArraysDecode)
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data_0 : eld::arinc429::data_descriptor<data_0, 11, 13, uint8_t>
+    {
+    };
+    struct data_1 : eld::arinc429::data_descriptor<data_1, 14, 15, uint8_t>
+    {
+    };
+    struct data_2 : eld::arinc429::data_descriptor<data_2, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    struct state_matrix : eld::arinc429::data_descriptor<state_matrix, 30, 31, uint8_t>
+    {
+    };
+    struct parity : eld::arinc429::data_descriptor<parity, 32, 32, uint8_t>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, data_0, data_1, data_2, state_matrix, parity>;
+
+    auto rawWords = make_raw_words(19);
+    rawWords.front() = 0xf3f21872;
+
+    const size_t size = rawWords.size();
+    std::vector<uint8_t> labels(size), data_0s(size), data_1s(size), state_matrixes(size),
+        parities(size);
+    std::vector<double> data_2s(size);
+
+    eld::arinc429::decode_soa<word_t>(rawWords.data(),
+                                      size,
+                                      labels.data(),
+                                      data_0s.data(),
+                                      data_1s.data(),
+                                      data_2s.data(),
+                                      state_matrixes.data(),
+                                      parities.data());
+
+    EXPECT_EQ(0162, labels.front());
+    EXPECT_EQ(-135.78399999999999, data_2s.front());
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        word_t word{ rawWords[i] };
+        EXPECT_EQ(word.get<label>(), labels[i]);
+        EXPECT_EQ(word.get<data_0>(), data_0s[i]);
+        EXPECT_EQ(word.get<data_1>(), data_1s[i]);
+        EXPECT_EQ(word.get<data_2>(), data_2s[i]);
+        EXPECT_EQ(word.get<state_matrix>(), state_matrixes[i]);
+        EXPECT_EQ(word.get<parity>(), parities[i]);
+    }
+}
+
+TEST(BatchTests, ValidateParity)
+{
+    // not a multiple of any vector width and more than 64 words to cover multiple mask elements
+    const auto rawWords = make_raw_words(133);
+
+    std::vector<uint64_t> badWords((rawWords.size() + 63) / 64, ~uint64_t(0));
+    const auto badCount =
+        eld::arinc429::validate_parity_batch(rawWords.data(), rawWords.size(), badWords.data());
+
+    size_t expectedBadCount = 0;
+    for (size_t i = 0; i < rawWords.size(); ++i)
+    {
+        const bool expectedBad = !eld::arinc429::validate_parity(rawWords[i]);
+        expectedBadCount += expectedBad;
+        EXPECT_EQ(expectedBad, bool((badWords[i / 64] >> (i % 64)) & 1)) << "index " << i;
+    }
+    EXPECT_EQ(expectedBadCount, badCount);
+    EXPECT_EQ(0u, badWords.back() >> (rawWords.size() % 64));
+}
+
+TEST(BatchTests, Bcd)
+{
+    struct data : eld::arinc429::bcd_descriptor<data, 11, 29>
+    {
+    };
+
+    std::vector<uint32_t> values(29);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = uint32_t(i * 2741 % 80000);
+    }
+
+    std::vector<eld::arinc429::traits::word_raw_type> rawWords(values.size());
+    eld::arinc429::encode_batch<data>(values.data(), values.size(), rawWords.data());
+
+    std::vector<uint32_t> decoded(values.size());
+    eld::arinc429::decode_batch<data>(rawWords.data(), rawWords.size(), decoded.data());
+
+    EXPECT_EQ(values, decoded);
+    expect_batch_same_as_word<data>();
+}
+
+TEST(BatchTests, FilterSsm)
+{
+    struct ssm : eld::arinc429::ssm_descriptor<ssm>
+    {
+    };
+    using word_t = eld::arinc429::word_generic<ssm>;
+
+    const auto rawWords = make_raw_words(133);
+
+    const uint8_t ssmMasks[]{ eld::arinc429::bnr_valid_ssm,
+                              eld::arinc429::ssm_mask(eld::arinc429::bnr_ssm::no_computed_data),
+                              eld::arinc429::any_ssm,
+                              eld::arinc429::ssm_mask() };
+    for (const uint8_t acceptedSsm : ssmMasks)
+    {
+        std::vector<uint32_t> expected;
+        for (size_t i = 0; i < rawWords.size(); ++i)
+        {
+            word_t word{ rawWords[i] };
+            if ((acceptedSsm >> word.get<ssm>()) & 1)
+            {
+                expected.push_back(uint32_t(i));
+            }
+        }
+
+        std::vector<uint32_t> indices(rawWords.size());
+        indices.resize(eld::arinc429::filter_ssm_batch(rawWords.data(),
+                                                       rawWords.size(),
+                                                       acceptedSsm,
+                                                       indices.data()));
+        EXPECT_EQ(expected, indices);
+    }
+}
+
+TEST(BatchTests, PartitionSdi)
+{
+    struct sdi : eld::arinc429::sdi_descriptor<sdi>
+    {
+    };
+    struct ssm : eld::arinc429::ssm_descriptor<ssm>
+    {
+    };
+    using word_t = eld::arinc429::word_generic<sdi, ssm>;
+
+    const auto rawWords = make_raw_words(133);
+
+    std::vector<eld::arinc429::traits::word_raw_type> expected[4];
+    for (const auto rawWord : rawWords)
+    {
+        word_t word{ rawWord };
+        if (word.get<ssm>() == uint8_t(eld::arinc429::bnr_ssm::normal_operation) ||
+            word.get<ssm>() == uint8_t(eld::arinc429::bnr_ssm::functional_test))
+        {
+            expected[word.get<sdi>()].push_back(rawWord);
+        }
+    }
+
+    std::vector<eld::arinc429::traits::word_raw_type> buffers[4];
+    for (auto &buffer : buffers)
+    {
+        buffer.resize(rawWords.size());
+    }
+    eld::arinc429::traits::word_raw_type *const out[]{ buffers[0].data(),
+                                                       buffers[1].data(),
+                                                       buffers[2].data(),
+                                                       buffers[3].data() };
+    size_t counts[4]{};
+    const size_t accepted = eld::arinc429::partition_sdi_batch(rawWords.data(),
+                                                               rawWords.size(),
+                                                               out,
+                                                               counts,
+                                                               eld::arinc429::bnr_valid_ssm);
+
+    size_t expectedAccepted = 0;
+    for (size_t sdiValue = 0; sdiValue < 4; ++sdiValue)
+    {
+        buffers[sdiValue].resize(counts[sdiValue]);
+        EXPECT_EQ(expected[sdiValue], buffers[sdiValue]) << "SDI " << sdiValue;
+        expectedAccepted += expected[sdiValue].size();
+    }
+    EXPECT_EQ(expectedAccepted, accepted);
+
+    // all words by default
+    eld::arinc429::partition_sdi_batch(rawWords.data(), rawWords.size(), out, counts);
+    EXPECT_EQ(rawWords.size(), counts[0] + counts[1] + counts[2] + counts[3]);
+}
+
+TEST(BatchTests, RawCopy)
+{
+    struct label : eld::arinc429::label_descriptor<label>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 9, 29, int32_t>
+    {
+    };
+    using word_t = eld::arinc429::word_generic<label, data>;
+
+    const auto rawWords = make_raw_words(67);
+
+    std::vector<word_t> words(rawWords.size());
+    eld::arinc429::from_raw_batch(rawWords.data(), rawWords.size(), words.data());
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+        EXPECT_EQ(rawWords[i], words[i].get_raw());
+    }
+
+    std::vector<eld::arinc429::traits::word_raw_type> copies(words.size());
+    eld::arinc429::to_raw_batch(words.data(), words.size(), copies.data());
+    EXPECT_EQ(rawWords, copies);
+}
@@ -0,0 +1,144 @@
+
+#include "arinc429/capture.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::string capture_path(const char *name) { return testing::TempDir() + name; }
+
+    std::vector<eld::arinc429::capture_record> make_records(size_t count)
+    {
+        std::vector<eld::arinc429::capture_record> records(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            records[i].timestamp = 1000 * i;
+            // label 0312 in every 10th record, 0162 otherwise
+            records[i].word = uint32_t(i << 8) | (i % 10 == 0 ? 0312u : 0162u);
+            records[i].channel = uint16_t(i % 2);
+        }
+        return records;
+    }
+}
+
+TEST(CaptureTests, WriteAndRead)
+{
+    const auto path = capture_path("capture_write_and_read.a429");
+    const auto records = make_records(1000);
+
+    eld::arinc429::capture_writer writer(64);
+    ASSERT_TRUE(writer.open(path.c_str()));
+    EXPECT_TRUE(writer.write(records.data(), 999));
+    EXPECT_TRUE(writer.write(records.back()));
+    EXPECT_TRUE(writer.close());
+
+    eld::arinc429::capture_reader reader;
+    ASSERT_TRUE(reader.open(path.c_str()));
+    EXPECT_EQ(eld::arinc429::capture_version, reader.header().version);
+    EXPECT_EQ(64u, reader.header().block_size);
+
+    const auto view = reader.records();
+    ASSERT_EQ(records.size(), view.size());
+    for (size_t i = 0; i < view.size(); ++i)
+    {
+        EXPECT_EQ(records[i].timestamp, view[i].timestamp);
+        EXPECT_EQ(records[i].word, view[i].word);
+        EXPECT_EQ(records[i].channel, view[i].channel);
+    }
+
+    ASSERT_EQ(16u, reader.blocks_count());
+    EXPECT_EQ(64u, reader.block(0).size());
+    EXPECT_EQ(1000u - 15 * 64, reader.block(15).size());
+    EXPECT_EQ(records[64].word, reader.block(1)[0].word);
+}
+
+TEST(CaptureTests, BlockIndex)
+{
+    const auto path = capture_path("capture_block_index.a429");
+    auto records = make_records(100);
+    // the only record with label 0100
+    records[70].word = 0100;
+
+    eld::arinc429::capture_writer writer(16);
+    ASSERT_TRUE(writer.open(path.c_str()));
+    EXPECT_TRUE(writer.write(records.data(), records.size()));
+    EXPECT_TRUE(writer.close());
+
+    eld::arinc429::capture_reader reader;
+    ASSERT_TRUE(reader.open(path.c_str()));
+    ASSERT_EQ(7u, reader.blocks_count());
+    EXPECT_TRUE(reader.block_labels(4).contains(0100));
+    EXPECT_FALSE(reader.block_labels(3).contains(0100));
+
+    size_t blocks = 0;
+    size_t found = 0;
+    reader.for_each_block(0100, [&](eld::arinc429::capture_view block) {
+        ++blocks;
+        for (const auto &record : block)
+        {
+            found += record.word == 0100;
+        }
+    });
+    EXPECT_EQ(1u, blocks);
+    EXPECT_EQ(1u, found);
+}
+
+TEST(CaptureTests, RejectInvalidFiles)
+{
+    eld::arinc429::capture_reader reader;
+    EXPECT_FALSE(reader.open(capture_path("capture_missing.a429").c_str()));
+    EXPECT_FALSE(reader.is_open());
+
+    const auto path = capture_path("capture_invalid.a429");
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    const std::vector<char> garbage(100, 'x');
+    std::fwrite(garbage.data(), 1, garbage.size(), file);
+    std::fclose(file);
+    EXPECT_FALSE(reader.open(path.c_str()));
+
+    // truncated records
+    eld::arinc429::capture_writer writer;
+    ASSERT_TRUE(writer.open(path.c_str()));
+    const auto records = make_records(10);
+    writer.write(records.data(), records.size());
+    ASSERT_TRUE(writer.close());
+    ASSERT_TRUE(reader.open(path.c_str()));
+    reader.close();
+
+    file = std::fopen(path.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    eld::arinc429::capture_header header{};
+    ASSERT_EQ(1u, std::fread(&header, sizeof(header), 1, file));
+    header.records_count = 1000;
+    std::fseek(file, 0, SEEK_SET);
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fclose(file);
+    EXPECT_FALSE(reader.open(path.c_str()));
+}
+
+TEST(CaptureTests, RejectOverflowingHeader)
+{
+    // records and index sizes wrap around to fit into a header only file
+    eld::arinc429::capture_header header{};
+    std::memcpy(header.magic, eld::arinc429::detail::capture_magic, sizeof(header.magic));
+    header.version = eld::arinc429::capture_version;
+    header.header_size = sizeof(header);
+    header.record_size = sizeof(eld::arinc429::capture_record);
+    header.records_count = uint64_t(1) << 60;
+    header.index_offset = sizeof(header);
+    header.block_size = 1;
+
+    const auto path = capture_path("capture_overflow.a429");
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fclose(file);
+
+    eld::arinc429::capture_reader reader;
+    EXPECT_FALSE(reader.open(path.c_str()));
+    EXPECT_FALSE(reader.is_open());
+}
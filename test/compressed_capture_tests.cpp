@@ -0,0 +1,274 @@
+
+#include "arinc429/compressed_capture.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::string capture_path(const char *name) { return testing::TempDir() + name; }
+
+    /**
+     * Slowly changing data of a few labels on two channels, received every 100 ticks.
+     */
+    std::vector<eld::arinc429::capture_record> make_records(size_t count)
+    {
+        static constexpr uint8_t labels[]{ 0203, 0204, 0205, 0206, 0312 };
+
+        std::vector<eld::arinc429::capture_record> records(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint8_t label = labels[i % 5];
+            const uint32_t data = uint32_t(i / 50 + label * 1000) & 0x7ffff;
+            records[i].timestamp = 1000000 + 100 * i;
+            records[i].word = 0x60000000u | data << 10 | label;
+            records[i].channel = uint16_t(i % 2);
+        }
+        return records;
+    }
+
+    void expect_same_records(const eld::arinc429::capture_record *expected,
+                             const eld::arinc429::capture_record *actual,
+                             size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(expected[i].timestamp, actual[i].timestamp) << "record " << i;
+            ASSERT_EQ(expected[i].word, actual[i].word) << "record " << i;
+            ASSERT_EQ(expected[i].channel, actual[i].channel) << "record " << i;
+            ASSERT_EQ(expected[i].flags, actual[i].flags) << "record " << i;
+        }
+    }
+
+    long file_size(const std::string &path)
+    {
+        std::FILE *file = std::fopen(path.c_str(), "rb");
+        std::fseek(file, 0, SEEK_END);
+        const long size = std::ftell(file);
+        std::fclose(file);
+        return size;
+    }
+}
+
+TEST(CompressedCaptureTests, WriteAndRead)
+{
+    const auto path = capture_path("compressed_write_and_read.a429z");
+    const auto records = make_records(10000);
+
+    eld::arinc429::compressed_capture_writer writer(1024);
+    ASSERT_TRUE(writer.open(path.c_str()));
+    EXPECT_TRUE(writer.write(records.data(), 9999));
+    EXPECT_TRUE(writer.write(records.back()));
+    EXPECT_TRUE(writer.close());
+
+    // a few bytes per record instead of 16
+    EXPECT_LT(file_size(path), long(records.size() * sizeof(records[0]) / 3));
+
+    eld::arinc429::compressed_capture_reader reader;
+    ASSERT_TRUE(reader.open(path.c_str()));
+    EXPECT_EQ(eld::arinc429::compressed_capture_version, reader.header().version);
+    EXPECT_EQ(records.size(), reader.records_count());
+    ASSERT_EQ(10u, reader.blocks_count());
+
+    std::vector<eld::arinc429::capture_record> decoded;
+    ASSERT_TRUE(reader.decode(decoded));
+    ASSERT_EQ(records.size(), decoded.size());
+    expect_same_records(records.data(), decoded.data(), records.size());
+
+    std::vector<eld::arinc429::capture_record> parallel;
+    ASSERT_TRUE(reader.decode(parallel, 3));
+    ASSERT_EQ(records.size(), parallel.size());
+    expect_same_records(records.data(), parallel.data(), records.size());
+}
+
+TEST(CompressedCaptureTests, ArbitraryRecords)
+{
+    const auto path = capture_path("compressed_arbitrary.a429z");
+
+    std::vector<eld::arinc429::capture_record> records(777);
+    uint32_t state = 0xf3f21872;
+    for (auto &record : records)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        // timestamps jump in both directions
+        record.timestamp = uint64_t(state) * (state & 1 ? 0x100000001ull : 1);
+        record.word = state * 2654435761u;
+        record.channel = uint16_t(state >> 7);
+        record.flags = uint16_t(state >> 11);
+    }
+    records[5].timestamp = 0;
+    records[6].timestamp = std::numeric_limits<uint64_t>::max();
+
+    eld::arinc429::compressed_capture_writer writer(100);
+    ASSERT_TRUE(writer.open(path.c_str()));
+    ASSERT_TRUE(writer.write(records.data(), records.size()));
+    ASSERT_TRUE(writer.close());
+
+    eld::arinc429::compressed_capture_reader reader;
+    ASSERT_TRUE(reader.open(path.c_str()));
+    std::vector<eld::arinc429::capture_record> decoded;
+    ASSERT_TRUE(reader.decode(decoded, 2));
+    ASSERT_EQ(records.size(), decoded.size());
+    expect_same_records(records.data(), decoded.data(), records.size());
+}
+
+TEST(CompressedCaptureTests, RandomAccess)
+{
+    const auto path = capture_path("compressed_random_access.a429z");
+    auto records = make_records(1000);
+    // the only record with label 0100
+    records[700].word = 0100;
+
+    eld::arinc429::compressed_capture_writer writer(64);
+    ASSERT_TRUE(writer.open(path.c_str()));
+    EXPECT_TRUE(writer.write(records.data(), records.size()));
+    EXPECT_TRUE(writer.close());
+
+    eld::arinc429::compressed_capture_reader reader;
+    ASSERT_TRUE(reader.open(path.c_str()));
+    ASSERT_EQ(16u, reader.blocks_count());
+
+    std::vector<eld::arinc429::capture_record> block;
+    ASSERT_TRUE(reader.decode_block(15, block));
+    ASSERT_EQ(1000u - 15 * 64, block.size());
+    expect_same_records(records.data() + 15 * 64, block.data(), block.size());
+
+    EXPECT_EQ(records[3 * 64].timestamp, reader.block_info(3).first_timestamp);
+    EXPECT_EQ(records[4 * 64 - 1].timestamp, reader.block_info(3).last_timestamp);
+    EXPECT_EQ(0u, reader.find_block(0));
+    EXPECT_EQ(5u, reader.find_block(records[5 * 64 + 10].timestamp));
+    EXPECT_EQ(16u, reader.find_block(records.back().timestamp + 1));
+    for (size_t i = 0; i < reader.blocks_count(); ++i)
+    {
+        EXPECT_EQ(i, reader.find_block(reader.block_info(i).last_timestamp));
+        EXPECT_EQ(i + 1, reader.find_block(reader.block_info(i).last_timestamp + 1));
+    }
+
+    std::vector<eld::arinc429::capture_record> range;
+    ASSERT_TRUE(reader.decode_blocks(5, 3, range, 2));
+    ASSERT_EQ(3u * 64, range.size());
+    expect_same_records(records.data() + 5 * 64, range.data(), range.size());
+
+    size_t blocks = 0;
+    size_t found = 0;
+    EXPECT_TRUE(reader.for_each_block(0100, [&](eld::arinc429::capture_view view) {
+        ++blocks;
+        for (const auto &record : view)
+        {
+            found += record.word == 0100;
+        }
+    }));
+    EXPECT_EQ(1u, blocks);
+    EXPECT_EQ(1u, found);
+}
+
+TEST(CompressedCaptureTests, Empty)
+{
+    const auto path = capture_path("compressed_empty.a429z");
+
+    eld::arinc429::compressed_capture_writer writer;
+    ASSERT_TRUE(writer.open(path.c_str()));
+    ASSERT_TRUE(writer.close());
+
+    eld::arinc429::compressed_capture_reader reader;
+    ASSERT_TRUE(reader.open(path.c_str()));
+    EXPECT_EQ(0u, reader.blocks_count());
+    std::vector<eld::arinc429::capture_record> decoded(1);
+    EXPECT_TRUE(reader.decode(decoded));
+    EXPECT_TRUE(decoded.empty());
+}
+
+TEST(CompressedCaptureTests, RejectInvalidFiles)
+{
+    eld::arinc429::compressed_capture_reader reader;
+    EXPECT_FALSE(reader.open(capture_path("compressed_missing.a429z").c_str()));
+
+    // uncompressed capture
+    const auto path = capture_path("compressed_invalid.a429z");
+    const auto records = make_records(100);
+    eld::arinc429::capture_writer captureWriter;
+    ASSERT_TRUE(captureWriter.open(path.c_str()));
+    captureWriter.write(records.data(), records.size());
+    ASSERT_TRUE(captureWriter.close());
+    EXPECT_FALSE(reader.open(path.c_str()));
+
+    eld::arinc429::compressed_capture_writer writer(50);
+    ASSERT_TRUE(writer.open(path.c_str()));
+    writer.write(records.data(), records.size());
+    ASSERT_TRUE(writer.close());
+    ASSERT_TRUE(reader.open(path.c_str()));
+    reader.close();
+
+    // corrupted control byte of the first record of the second block
+    {
+        eld::arinc429::compressed_capture_reader validReader;
+        ASSERT_TRUE(validReader.open(path.c_str()));
+        const uint64_t offset = validReader.block_info(1).offset;
+        validReader.close();
+
+        std::FILE *file = std::fopen(path.c_str(), "r+b");
+        ASSERT_NE(nullptr, file);
+        std::fseek(file, long(offset), SEEK_SET);
+        const uint8_t control = 0x0f;
+        std::fwrite(&control, 1, 1, file);
+        std::fclose(file);
+    }
+    ASSERT_TRUE(reader.open(path.c_str()));
+    std::vector<eld::arinc429::capture_record> decoded;
+    EXPECT_TRUE(reader.decode_block(0, decoded));
+    EXPECT_FALSE(reader.decode_block(1, decoded));
+    EXPECT_FALSE(reader.decode(decoded, 2));
+    reader.close();
+
+    // index beyond the end of the file
+    std::FILE *file = std::fopen(path.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    eld::arinc429::capture_header header{};
+    ASSERT_EQ(1u, std::fread(&header, sizeof(header), 1, file));
+    header.records_count = 1000;
+    std::fseek(file, 0, SEEK_SET);
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fclose(file);
+    EXPECT_FALSE(reader.open(path.c_str()));
+}
+
+TEST(CompressedCaptureTests, RejectRecordsBeyondData)
+{
+    // a single block of 2^32 - 1 records in a 200 bytes file
+    eld::arinc429::capture_header header{};
+    std::memcpy(header.magic,
+                eld::arinc429::detail::compressed_capture_magic,
+                sizeof(header.magic));
+    header.version = eld::arinc429::compressed_capture_version;
+    header.header_size = sizeof(header);
+    header.record_size = sizeof(eld::arinc429::capture_record);
+    header.records_count = 0xffffffff;
+    header.block_size = 0xffffffff;
+    header.index_offset = 136;
+
+    eld::arinc429::compressed_capture_block block{};
+    block.offset = sizeof(header);
+    block.records_count = 0xffffffff;
+
+    const auto path = capture_path("compressed_overflow.a429z");
+    eld::arinc429::compressed_capture_reader reader;
+    for (const uint32_t blockSize : { 0u, 72u })
+    {
+        block.size = blockSize;
+        std::vector<uint8_t> bytes(header.index_offset + sizeof(block));
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        std::memcpy(bytes.data() + header.index_offset, &block, sizeof(block));
+
+        std::FILE *file = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(nullptr, file);
+        std::fwrite(bytes.data(), 1, bytes.size(), file);
+        std::fclose(file);
+        EXPECT_FALSE(reader.open(path.c_str())) << blockSize;
+    }
+}
@@ -0,0 +1,106 @@
+
+#include "arinc429/dispatch.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 9, 29, int32_t>
+    {
+    };
+    struct angle : eld::arinc429::data_descriptor<angle, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+
+    using data_word_t = eld::arinc429::word_generic<label, data>;
+    using angle_word_t = eld::arinc429::word_generic<label, angle>;
+
+    using dispatcher_t = eld::arinc429::label_dispatcher<
+        eld::arinc429::label_word<0312, data_word_t>,
+        eld::arinc429::label_word<0162, angle_word_t>>;
+
+    struct recording_handler
+    {
+        void operator()(data_word_t word) { data_values.push_back(word.get<data>()); }
+
+        void operator()(angle_word_t word) { angle_values.push_back(word.get<angle>()); }
+
+        std::vector<int32_t> data_values;
+        std::vector<double> angle_values;
+    };
+}
+
+TEST(DispatchTests, DispatchSingleWord)
+{
+    data_word_t dataWord{ 0 };
+    dataWord.set<label>(uint8_t(0312));
+    dataWord.set<data>(-9);
+
+    recording_handler handler;
+    const dispatcher_t dispatcher;
+
+    EXPECT_TRUE(dispatcher.dispatch(dataWord.get_raw(), handler));
+    EXPECT_TRUE(dispatcher.dispatch(0xf3f21872, handler));
+    EXPECT_FALSE(dispatcher.dispatch(0x00000011, handler));
+
+    ASSERT_EQ(1u, handler.data_values.size());
+    EXPECT_EQ(-9, handler.data_values.front());
+    ASSERT_EQ(1u, handler.angle_values.size());
+    EXPECT_EQ(-135.78399999999999, handler.angle_values.front());
+}
+
+TEST(DispatchTests, DispatchBuffer)
+{
+    std::vector<eld::arinc429::traits::word_raw_type> rawWords;
+    for (int32_t i = 0; i < 10; ++i)
+    {
+        data_word_t dataWord{ 0 };
+        dataWord.set<label>(uint8_t(0312));
+        dataWord.set<data>(i);
+        rawWords.push_back(dataWord.get_raw());
+        rawWords.push_back(0xf3f21872);
+        rawWords.push_back(uint32_t(i) << 8 | 0377);
+    }
+
+    size_t genericWords = 0;
+    const auto handled = dispatcher_t().dispatch(rawWords.data(),
+                                                 rawWords.size(),
+                                                 [&genericWords](auto) { ++genericWords; });
+    EXPECT_EQ(20u, handled);
+    EXPECT_EQ(20u, genericWords);
+
+    recording_handler handler;
+    dispatcher_t().dispatch(rawWords.data(), rawWords.size(), handler);
+    ASSERT_EQ(10u, handler.data_values.size());
+    for (int32_t i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(i, handler.data_values[i]);
+    }
+    EXPECT_EQ(10u, handler.angle_values.size());
+}
+
+TEST(DispatchTests, DispatchReversedLabels)
+{
+    struct reversed_label : eld::arinc429::label_descriptor<reversed_label>
+    {
+    };
+
+    using reversed_word_t = eld::arinc429::word_generic<reversed_label, data>;
+
+    reversed_word_t word{ 0 };
+    word.set<reversed_label>(uint8_t(0162));
+    word.set<data>(42);
+
+    int32_t value = 0;
+    const auto handled =
+        eld::arinc429::label_dispatcher<eld::arinc429::reversed_label_word<0162, reversed_word_t>>()
+            .dispatch(word.get_raw(), [&value](reversed_word_t w) { value = w.get<data>(); });
+
+    EXPECT_TRUE(handled);
+    EXPECT_EQ(42, value);
+}
@@ -0,0 +1,123 @@
+
+#include "arinc429/field_table.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+        static constexpr const char *name() { return "LABEL"; }
+    };
+    struct sdi : eld::arinc429::data_descriptor<sdi, 9, 10, uint8_t>
+    {
+    };
+    struct heading
+      : eld::arinc429::
+            bnr_descriptor<heading, 15, eld::arinc429::bnr_resolution_t<std::ratio<180>, 15>>
+    {
+        static constexpr const char *name() { return "MAG_HEADING"; }
+    };
+    struct valid : eld::arinc429::discrete_descriptor<valid, 30>
+    {
+        static constexpr const char *name() { return "VALID"; }
+    };
+
+    /**
+     * Scale factor type other than std::ratio.
+     */
+    struct quarter
+    {
+        static constexpr intmax_t num = 1;
+        static constexpr intmax_t den = 4;
+    };
+
+    using heading_word_t = eld::arinc429::word_generic<label, sdi, heading, valid>;
+    using table_t = eld::arinc429::field_table<heading_word_t>;
+}
+
+TEST(FieldTableTests, FindByName)
+{
+    const auto *field = table_t::find("MAG_HEADING");
+    ASSERT_NE(nullptr, field);
+    EXPECT_STREQ("MAG_HEADING", field->name);
+    EXPECT_EQ(14u, field->lsb);
+    EXPECT_EQ(29u, field->msb);
+    EXPECT_DOUBLE_EQ(180.0 / (1 << 15), field->scale);
+
+    ASSERT_NE(nullptr, table_t::find("LABEL"));
+    EXPECT_EQ(1u, table_t::find("LABEL")->lsb);
+    ASSERT_NE(nullptr, table_t::find(std::string("VALID").c_str()));
+
+    EXPECT_EQ(nullptr, table_t::find("heading"));
+    EXPECT_EQ(nullptr, table_t::find(""));
+    EXPECT_EQ(nullptr, table_t::find("VALID "));
+
+    EXPECT_EQ(4, table_t::end() - table_t::begin());
+    EXPECT_EQ(nullptr, table_t::begin()[1].name);
+}
+
+TEST(FieldTableTests, GetAndSetByName)
+{
+    heading_word_t word{ 0 };
+    EXPECT_TRUE(table_t::set(word, "LABEL", 0320));
+    EXPECT_TRUE(table_t::set(word, "MAG_HEADING", -90.0));
+    EXPECT_TRUE(table_t::set(word, "VALID", 1));
+    EXPECT_FALSE(table_t::set(word, "SDI", 1));
+
+    EXPECT_EQ(0320, word.get<label>());
+    EXPECT_EQ(-90.0, word.get<heading>());
+    EXPECT_TRUE(word.get<valid>());
+
+    double value = 0;
+    ASSERT_TRUE(table_t::get(word, "MAG_HEADING", value));
+    EXPECT_EQ(word.get<heading>(), value);
+    ASSERT_TRUE(table_t::get(word, "LABEL", value));
+    EXPECT_EQ(0320, value);
+    EXPECT_FALSE(table_t::get(word, "UNKNOWN", value));
+}
+
+TEST(FieldTableTests, CustomScaleType)
+{
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, double, quarter>
+    {
+        static constexpr const char *name() { return "DATA"; }
+    };
+    using word_t = eld::arinc429::word_generic<data>;
+
+    const auto *field = eld::arinc429::field_table<word_t>::find("DATA");
+    ASSERT_NE(nullptr, field);
+    EXPECT_DOUBLE_EQ(0.25, field->scale);
+}
+
+TEST(FieldTableTests, IntegralScale)
+{
+    // std::ratio does not scale integral values, fixed_scale does
+    struct counts : eld::arinc429::data_descriptor<counts, 11, 18, int32_t, std::ratio<1, 4>>
+    {
+        static constexpr const char *name() { return "COUNTS"; }
+    };
+    struct fixed : eld::arinc429::data_descriptor<fixed,
+                                                  19,
+                                                  26,
+                                                  int32_t,
+                                                  eld::arinc429::fixed_scale<std::ratio<4>>>
+    {
+        static constexpr const char *name() { return "FIXED"; }
+    };
+    using word_t = eld::arinc429::word_generic<counts, fixed>;
+    using fields_t = eld::arinc429::field_table<word_t>;
+
+    word_t word{ 0 };
+    word.set<counts>(12);
+    word.set<fixed>(20);
+    double value = 0;
+    ASSERT_TRUE(fields_t::get(word, "COUNTS", value));
+    EXPECT_DOUBLE_EQ(12, value);
+    EXPECT_DOUBLE_EQ(1.0, fields_t::find("COUNTS")->scale);
+    ASSERT_TRUE(fields_t::get(word, "FIXED", value));
+    EXPECT_DOUBLE_EQ(20, value);
+    EXPECT_DOUBLE_EQ(4.0, fields_t::find("FIXED")->scale);
+}
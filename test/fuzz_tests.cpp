@@ -0,0 +1,518 @@
+
+#include "arinc429/batch.h"
+#include "arinc429/runtime_layout.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Cross-check of the fast decode and encode paths against the reference runtime bit range
+ * implementation (get_integral_value and set_integral_value) on randomly generated layouts,
+ * and throughput of each path. Built once for each supported C++ standard.
+ */
+
+namespace
+{
+    constexpr size_t layouts_count = 32;
+    constexpr size_t fields_count = 4;
+    constexpr size_t min_width = 2;
+
+    constexpr uint32_t xorshift(uint32_t state)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    constexpr uint32_t random(size_t seed, size_t index)
+    {
+        uint32_t state = xorshift(uint32_t(seed * 2654435761u + 0x9e3779b9u));
+        for (size_t i = 0; i <= index; ++i)
+        {
+            state = xorshift(state);
+        }
+        return state;
+    }
+
+    /**
+     * Fields of a layout cover all 32 bits, each field at least min_width bits wide.
+     */
+    constexpr size_t field_lsb(size_t seed, size_t field)
+    {
+        constexpr size_t spare = 32 - fields_count * min_width;
+
+        size_t cuts[fields_count - 1]{};
+        for (size_t i = 0; i < fields_count - 1; ++i)
+        {
+            cuts[i] = random(seed, i) % (spare + 1);
+        }
+        for (size_t i = 1; i < fields_count - 1; ++i)
+        {
+            for (size_t j = i; j > 0 && cuts[j - 1] > cuts[j]; --j)
+            {
+                const size_t cut = cuts[j];
+                cuts[j] = cuts[j - 1];
+                cuts[j - 1] = cut;
+            }
+        }
+        return 1 + field * min_width + (field == 0 ? 0 : cuts[field - 1]);
+    }
+
+    constexpr size_t field_msb(size_t seed, size_t field)
+    {
+        return field + 1 == fields_count ? 32 : field_lsb(seed, field + 1) - 1;
+    }
+
+    enum class field_kind
+    {
+        unsigned_integral,
+        signed_integral,
+        scaled,
+        fixed_scaled
+    };
+
+    constexpr field_kind kind_of(size_t seed, size_t field)
+    {
+        return field_kind(random(seed, fields_count + field) % 4);
+    }
+
+    template<field_kind Kind>
+    struct kind_traits;
+
+    template<>
+    struct kind_traits<field_kind::unsigned_integral>
+    {
+        using value_type = uint32_t;
+        using scale_factor_type = std::ratio<1>;
+        static constexpr double scale = 1.0;
+    };
+
+    template<>
+    struct kind_traits<field_kind::signed_integral>
+    {
+        using value_type = int32_t;
+        using scale_factor_type = std::ratio<1>;
+        static constexpr double scale = 1.0;
+    };
+
+    template<>
+    struct kind_traits<field_kind::scaled>
+    {
+        using value_type = double;
+        using scale_factor_type = std::ratio<1, 16>;
+        static constexpr double scale = 1.0 / 16;
+    };
+
+    template<>
+    struct kind_traits<field_kind::fixed_scaled>
+    {
+        using value_type = double;
+        using scale_factor_type = eld::arinc429::fixed_scale<std::ratio<1, 8>>;
+        static constexpr double scale = 1.0 / 8;
+    };
+
+    template<size_t Seed, size_t Field>
+    struct fuzz_field
+      : eld::arinc429::data_descriptor<
+            fuzz_field<Seed, Field>,
+            field_lsb(Seed, Field),
+            field_msb(Seed, Field),
+            typename kind_traits<kind_of(Seed, Field)>::value_type,
+            typename kind_traits<kind_of(Seed, Field)>::scale_factor_type>
+    {
+        static constexpr field_kind kind = kind_of(Seed, Field);
+        static constexpr double scale = kind_traits<kind>::scale;
+    };
+
+    template<size_t Seed, typename = std::make_index_sequence<fields_count>>
+    struct fuzz_layout;
+
+    template<size_t Seed, size_t... Fields>
+    struct fuzz_layout<Seed, std::index_sequence<Fields...>>
+    {
+        using word_type = eld::arinc429::word_generic<fuzz_field<Seed, Fields>...>;
+    };
+
+    template<size_t Seed>
+    using fuzz_word_t = typename fuzz_layout<Seed>::word_type;
+
+    template<typename FieldT>
+    using value_t = eld::arinc429::traits::value_type_t<FieldT>;
+
+    template<typename FieldT>
+    value_t<FieldT> reference_get(eld::arinc429::traits::word_raw_type wordRaw)
+    {
+        value_t<FieldT> value{};
+        eld::arinc429::get_value(value, wordRaw, FieldT::lsb(), FieldT::msb(), FieldT::scale);
+        return value;
+    }
+
+    template<typename FieldT>
+    void reference_set(const value_t<FieldT> &value, eld::arinc429::traits::word_raw_type &wordRaw)
+    {
+        eld::arinc429::set_value(value, wordRaw, FieldT::lsb(), FieldT::msb(), FieldT::scale);
+    }
+
+    template<typename FieldT>
+    eld::arinc429::runtime_field runtime_field_of()
+    {
+        using eld::arinc429::runtime_field_type;
+        const runtime_field_type type =
+            FieldT::kind == field_kind::unsigned_integral ? runtime_field_type::unsigned_integral
+            : FieldT::kind == field_kind::signed_integral ? runtime_field_type::signed_integral
+                                                          : runtime_field_type::floating_point;
+        return eld::arinc429::runtime_field{ std::string(),
+                                             FieldT::lsb(),
+                                             FieldT::msb(),
+                                             type,
+                                             FieldT::scale };
+    }
+
+    std::vector<eld::arinc429::traits::word_raw_type> make_raw_words(size_t count, uint32_t seed)
+    {
+        std::vector<eld::arinc429::traits::word_raw_type> rawWords(count);
+        uint32_t state = xorshift(seed | 1u);
+        for (auto &rawWord : rawWords)
+        {
+            state = xorshift(state);
+            rawWord = state;
+        }
+        // extreme values of all fields
+        rawWords[0] = 0;
+        rawWords[1] = 0xffffffff;
+        rawWords[2] = 0xaaaaaaaa;
+        rawWords[3] = 0x55555555;
+        return rawWords;
+    }
+
+    template<size_t Seed, size_t Field>
+    void check_field(const std::vector<eld::arinc429::traits::word_raw_type> &rawWords,
+                     const std::vector<double> &planValues)
+    {
+        using field_t = fuzz_field<Seed, Field>;
+        using word_t = fuzz_word_t<Seed>;
+
+        SCOPED_TRACE("field " + std::to_string(Field) + " bits " +
+                     std::to_string(field_t::lsb()) + "-" + std::to_string(field_t::msb()) +
+                     " kind " + std::to_string(int(field_t::kind)));
+
+        const size_t n = rawWords.size();
+        std::vector<value_t<field_t>> expected(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            expected[i] = reference_get<field_t>(rawWords[i]);
+        }
+
+        // compile-time masks
+        for (size_t i = 0; i < n; ++i)
+        {
+            ASSERT_EQ(expected[i], word_t(rawWords[i]).template get<field_t>()) << "word " << i;
+        }
+
+        // batch, vectorized where available
+        std::vector<value_t<field_t>> decoded(n);
+        eld::arinc429::decode_batch<field_t>(rawWords.data(), n, decoded.data());
+        ASSERT_EQ(expected, decoded);
+
+        // runtime plan
+        for (size_t i = 0; i < n; ++i)
+        {
+            ASSERT_EQ(double(expected[i]), planValues[i * fields_count + Field]) << "word " << i;
+        }
+
+        // encoding of the decoded values restores the bits of the field
+        const auto fieldMask = eld::arinc429::traits::field_mask<field_t, word_t>::value;
+        std::vector<eld::arinc429::traits::word_raw_type> encoded(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            eld::arinc429::traits::word_raw_type reference = ~rawWords[i];
+            reference_set<field_t>(expected[i], reference);
+            ASSERT_EQ(rawWords[i] & fieldMask, reference & fieldMask) << "word " << i;
+
+            word_t word{ ~rawWords[i] };
+            word.template set<field_t>(expected[i]);
+            ASSERT_EQ(reference, word.get_raw()) << "word " << i;
+            encoded[i] = ~rawWords[i];
+        }
+
+        eld::arinc429::encode_batch<field_t>(expected.data(), n, encoded.data());
+        for (size_t i = 0; i < n; ++i)
+        {
+            eld::arinc429::traits::word_raw_type reference = ~rawWords[i];
+            reference_set<field_t>(expected[i], reference);
+            ASSERT_EQ(reference, encoded[i]) << "word " << i;
+        }
+    }
+
+    template<size_t Seed, size_t... Fields>
+    void check_soa(const std::vector<eld::arinc429::traits::word_raw_type> &rawWords,
+                   std::index_sequence<Fields...>)
+    {
+        using word_t = fuzz_word_t<Seed>;
+        const size_t n = rawWords.size();
+
+        std::tuple<std::vector<value_t<fuzz_field<Seed, Fields>>>...> columns{
+            std::vector<value_t<fuzz_field<Seed, Fields>>>(n)...
+        };
+        eld::arinc429::decode_soa<word_t>(rawWords.data(), n, std::get<Fields>(columns).data()...);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto values =
+                std::make_tuple(reference_get<fuzz_field<Seed, Fields>>(rawWords[i])...);
+            ASSERT_TRUE(std::make_tuple(std::get<Fields>(columns)[i]...) == values) << "word " << i;
+
+            // all fields cover all bits, so set_all reproduces the word
+            word_t word{ 0 };
+            word.set_all(std::get<Fields>(values)...);
+            ASSERT_EQ(rawWords[i], word.get_raw()) << "word " << i;
+        }
+    }
+
+    template<size_t Seed, size_t... Fields>
+    void check_layout(std::index_sequence<Fields...> fields)
+    {
+        SCOPED_TRACE("layout " + std::to_string(Seed));
+
+        const auto rawWords = make_raw_words(257, uint32_t(Seed));
+        const eld::arinc429::runtime_word_layout plan(
+            { runtime_field_of<fuzz_field<Seed, Fields>>()... });
+        ASSERT_TRUE(plan.valid());
+        std::vector<double> planValues(rawWords.size() * fields_count);
+        plan.decode_batch(rawWords.data(), rawWords.size(), planValues.data());
+
+        const int expand[]{ 0, (check_field<Seed, Fields>(rawWords, planValues), 0)... };
+        (void)expand;
+        check_soa<Seed>(rawWords, fields);
+    }
+
+    enum variant
+    {
+        reference_decode,
+        word_decode,
+        batch_decode,
+        soa_decode,
+        plan_decode,
+        reference_encode,
+        word_encode,
+        batch_encode,
+        set_all_encode,
+        variants_count
+    };
+
+    constexpr const char *variant_names[variants_count]{ "reference_decode", "word_decode",
+                                                         "batch_decode",     "soa_decode",
+                                                         "plan_decode",      "reference_encode",
+                                                         "word_encode",      "batch_encode",
+                                                         "set_all_encode" };
+
+    /**
+     * Total time and number of processed words of each variant.
+     */
+    struct throughput
+    {
+        template<typename FunctionT>
+        void measure(variant index, size_t wordsCount, FunctionT &&function)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            nanoseconds[index] += uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                               std::chrono::steady_clock::now() - start)
+                                               .count());
+            words[index] += wordsCount;
+        }
+
+        uint64_t nanoseconds[variants_count]{};
+        uint64_t words[variants_count]{};
+        /**
+         * Keeps results from being optimized away.
+         */
+        double sink = 0;
+    };
+
+    template<typename T>
+    double checksum(const std::vector<T> &values)
+    {
+        double sum = 0;
+        for (const T &value : values)
+        {
+            sum += double(value);
+        }
+        return sum;
+    }
+
+    template<size_t Seed, size_t Field>
+    void measure_field(const std::vector<eld::arinc429::traits::word_raw_type> &rawWords,
+                       throughput &result)
+    {
+        using field_t = fuzz_field<Seed, Field>;
+        using word_t = fuzz_word_t<Seed>;
+        const size_t n = rawWords.size();
+
+        std::vector<value_t<field_t>> values(n);
+        std::vector<eld::arinc429::traits::word_raw_type> encoded(rawWords);
+
+        result.measure(reference_decode, n, [&] {
+            for (size_t i = 0; i < n; ++i)
+            {
+                values[i] = reference_get<field_t>(rawWords[i]);
+            }
+        });
+        result.sink += checksum(values);
+
+        result.measure(word_decode, n, [&] {
+            for (size_t i = 0; i < n; ++i)
+            {
+                values[i] = word_t(rawWords[i]).template get<field_t>();
+            }
+        });
+        result.sink += checksum(values);
+
+        result.measure(batch_decode, n, [&] {
+            eld::arinc429::decode_batch<field_t>(rawWords.data(), n, values.data());
+        });
+        result.sink += checksum(values);
+
+        result.measure(reference_encode, n, [&] {
+            for (size_t i = 0; i < n; ++i)
+            {
+                reference_set<field_t>(values[i], encoded[i]);
+            }
+        });
+        result.sink += checksum(encoded);
+
+        result.measure(word_encode, n, [&] {
+            for (size_t i = 0; i < n; ++i)
+            {
+                word_t word{ encoded[i] };
+                word.template set<field_t>(values[i]);
+                encoded[i] = word.get_raw();
+            }
+        });
+        result.sink += checksum(encoded);
+
+        result.measure(batch_encode, n, [&] {
+            eld::arinc429::encode_batch<field_t>(values.data(), n, encoded.data());
+        });
+        result.sink += checksum(encoded);
+    }
+
+    template<size_t Seed, size_t... Fields>
+    void measure_layout(throughput &result, std::index_sequence<Fields...>)
+    {
+        using word_t = fuzz_word_t<Seed>;
+
+        const auto rawWords = make_raw_words(16 * 1024, uint32_t(Seed));
+        const size_t n = rawWords.size();
+
+        const int expand[]{ 0, (measure_field<Seed, Fields>(rawWords, result), 0)... };
+        (void)expand;
+
+        // whole words are counted once for each field, same as the per-field variants
+        std::tuple<std::vector<value_t<fuzz_field<Seed, Fields>>>...> columns{
+            std::vector<value_t<fuzz_field<Seed, Fields>>>(n)...
+        };
+        result.measure(soa_decode, n * fields_count, [&] {
+            eld::arinc429::decode_soa<word_t>(rawWords.data(),
+                                              n,
+                                              std::get<Fields>(columns).data()...);
+        });
+        const double sums[]{ checksum(std::get<Fields>(columns))... };
+        for (const double sum : sums)
+        {
+            result.sink += sum;
+        }
+
+        const eld::arinc429::runtime_word_layout plan(
+            { runtime_field_of<fuzz_field<Seed, Fields>>()... });
+        std::vector<double> planValues(n * fields_count);
+        result.measure(plan_decode, n * fields_count, [&] {
+            plan.decode_batch(rawWords.data(), n, planValues.data());
+        });
+        result.sink += checksum(planValues);
+
+        std::vector<eld::arinc429::traits::word_raw_type> encoded(n);
+        result.measure(set_all_encode, n * fields_count, [&] {
+            for (size_t i = 0; i < n; ++i)
+            {
+                word_t word{ 0 };
+                word.set_all(std::get<Fields>(columns)[i]...);
+                encoded[i] = word.get_raw();
+            }
+        });
+        result.sink += checksum(encoded);
+    }
+
+    template<size_t... Seeds>
+    void measure_layouts(throughput &result, std::index_sequence<Seeds...>)
+    {
+        const int expand[]{
+            0,
+            (measure_layout<Seeds>(result, std::make_index_sequence<fields_count>()), 0)...
+        };
+        (void)expand;
+    }
+
+    std::string standard_name()
+    {
+        return __cplusplus >= 202002L   ? "cxx20"
+               : __cplusplus >= 201703L ? "cxx17"
+                                        : "cxx14";
+    }
+
+    template<size_t... Seeds>
+    void check_layouts(std::index_sequence<Seeds...>)
+    {
+        const int expand[]{
+            0,
+            (check_layout<Seeds>(std::make_index_sequence<fields_count>()), 0)...
+        };
+        (void)expand;
+    }
+}
+
+TEST(FuzzTests, LayoutsCoverAllBits)
+{
+    static_assert(field_lsb(0, 0) == 1 && field_msb(0, fields_count - 1) == 32, "");
+    for (size_t seed = 0; seed < layouts_count; ++seed)
+    {
+        for (size_t field = 0; field < fields_count; ++field)
+        {
+            EXPECT_GE(field_msb(seed, field) - field_lsb(seed, field) + 1, min_width);
+            if (field != 0)
+            {
+                EXPECT_EQ(field_msb(seed, field - 1) + 1, field_lsb(seed, field));
+            }
+        }
+    }
+}
+
+TEST(FuzzTests, SameAsReference)
+{
+    check_layouts(std::make_index_sequence<layouts_count>());
+}
+
+/**
+ * Throughput of each variant in million decoded or encoded fields per second, printed and
+ * recorded as test properties, e.g. in the XML report of --gtest_output=xml.
+ */
+TEST(FuzzTests, Throughput)
+{
+    throughput result;
+    measure_layouts(result, std::make_index_sequence<layouts_count>());
+    EXPECT_NE(0.0, result.sink);
+
+    for (size_t i = 0; i < variants_count; ++i)
+    {
+        const double nanoseconds = double(std::max<uint64_t>(result.nanoseconds[i], 1));
+        const double fieldsPerMicrosecond = double(result.words[i]) * 1000.0 / nanoseconds;
+        const std::string name = standard_name() + "_" + variant_names[i];
+        ::testing::Test::RecordProperty(name, std::to_string(fieldsPerMicrosecond));
+        std::cout << name << ": " << fieldsPerMicrosecond << " M fields/s" << std::endl;
+    }
+}
@@ -0,0 +1,146 @@
+
+#include "arinc429/instrumentation.h"
+#include "arinc429/label_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, int32_t>
+    {
+    };
+    struct ssm : eld::arinc429::ssm_descriptor<ssm>
+    {
+    };
+
+    using data_word_t = eld::arinc429::word_generic<label, data, ssm>;
+
+    eld::arinc429::traits::word_raw_type make_word(uint8_t labelValue,
+                                                   int32_t dataValue,
+                                                   eld::arinc429::bnr_ssm ssmValue,
+                                                   bool validParity = true)
+    {
+        data_word_t word{ 0 };
+        word.set_all(labelValue, dataValue, uint8_t(ssmValue));
+        word.finalize();
+        return validParity ? word.get_raw() : word.get_raw() ^ 0x80000000;
+    }
+
+    struct summing_handler
+    {
+        void operator()(data_word_t word) { sum += word.get<data>(); }
+
+        int64_t sum = 0;
+    };
+}
+
+TEST(InstrumentationTests, NullPolicyIsEmpty)
+{
+    static_assert(std::is_empty<eld::arinc429::null_instrumentation::decode_scope>(), "");
+    static_assert(sizeof(eld::arinc429::label_dispatcher<
+                         eld::arinc429::label_word<0312, data_word_t>>) == 1,
+                  "");
+}
+
+TEST(InstrumentationTests, CountDispatchedWords)
+{
+    struct tag;
+    using instrumentation_t = eld::arinc429::counting_instrumentation<tag>;
+    const eld::arinc429::basic_label_dispatcher<instrumentation_t,
+                                                eld::arinc429::label_word<0312, data_word_t>>
+        dispatcher;
+
+    const eld::arinc429::traits::word_raw_type words[]{
+        make_word(0312, 1, eld::arinc429::bnr_ssm::normal_operation),
+        make_word(0312, 2, eld::arinc429::bnr_ssm::failure_warning),
+        make_word(0312, 3, eld::arinc429::bnr_ssm::normal_operation, false),
+        make_word(0100, 4, eld::arinc429::bnr_ssm::no_computed_data),
+    };
+    summing_handler handler;
+    EXPECT_EQ(3u, dispatcher.dispatch(words, 4, handler));
+    EXPECT_EQ(6, handler.sum);
+
+    const eld::arinc429::label_statistics bound = instrumentation_t::aggregate(0312);
+    EXPECT_EQ(3u, bound.words);
+    EXPECT_EQ(1u, bound.parity_errors);
+    EXPECT_EQ(2u, bound.ssm[uint8_t(eld::arinc429::bnr_ssm::normal_operation)]);
+    EXPECT_EQ(1u, bound.ssm[uint8_t(eld::arinc429::bnr_ssm::failure_warning)]);
+    EXPECT_EQ(3u, bound.decodes);
+    EXPECT_EQ(2u, bound.intervals);
+    EXPECT_LE(bound.interval_min_nanoseconds, bound.interval_max_nanoseconds);
+    EXPECT_GE(bound.interval_jitter_nanoseconds(), 0.0);
+
+    // unbound labels are counted, but not decoded
+    eld::arinc429::label_statistics statistics[eld::arinc429::detail::labels_count];
+    instrumentation_t::aggregate(statistics);
+    EXPECT_EQ(1u, statistics[0100].words);
+    EXPECT_EQ(1u, statistics[0100].ssm[uint8_t(eld::arinc429::bnr_ssm::no_computed_data)]);
+    EXPECT_EQ(0u, statistics[0100].decodes);
+    EXPECT_EQ(0u, statistics[0100].intervals);
+    EXPECT_EQ(0u, statistics[0101].words);
+}
+
+TEST(InstrumentationTests, AggregateThreads)
+{
+    struct tag;
+    using instrumentation_t = eld::arinc429::counting_instrumentation<tag>;
+    eld::arinc429::basic_label_cache<1,
+                                     instrumentation_t,
+                                     eld::arinc429::label_word<0312, data_word_t>>
+        cache;
+
+    const auto word = make_word(0312, 5, eld::arinc429::bnr_ssm::normal_operation);
+    std::thread writer([&cache, word] {
+        for (int i = 0; i < 100; ++i)
+        {
+            cache.update(word);
+        }
+    });
+    writer.join();
+
+    // counters of finished threads are kept
+    EXPECT_EQ(100u, instrumentation_t::aggregate(0312).words);
+    EXPECT_EQ(99u, instrumentation_t::aggregate(0312).intervals);
+
+    const eld::arinc429::traits::word_raw_type words[]{ word, word };
+    EXPECT_EQ(2u, cache.update(words, 2));
+    const eld::arinc429::label_statistics statistics = instrumentation_t::aggregate(0312);
+    EXPECT_EQ(102u, statistics.words);
+    EXPECT_EQ(100u, statistics.intervals);
+    EXPECT_EQ(0u, statistics.decodes);
+}
+
+namespace
+{
+    /**
+     * Counts words of a joined thread and of the main thread, then exits the process.
+     */
+    void count_and_exit()
+    {
+        struct tag;
+        using instrumentation_t = eld::arinc429::counting_instrumentation<tag>;
+        eld::arinc429::basic_label_cache<1,
+                                         instrumentation_t,
+                                         eld::arinc429::label_word<0312, data_word_t>>
+            cache;
+
+        const auto word = make_word(0312, 5, eld::arinc429::bnr_ssm::normal_operation);
+        std::thread writer([&cache, word] { cache.update(word); });
+        writer.join();
+        cache.update(word);
+        std::exit(instrumentation_t::aggregate(0312).words == 2u ? 0 : 1);
+    }
+}
+
+TEST(InstrumentationTests, CountersOutliveExit)
+{
+    // counters of the main thread are merged at exit, while statics are being destroyed
+    EXPECT_EXIT(count_and_exit(), testing::ExitedWithCode(0), "");
+}
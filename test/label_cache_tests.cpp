@@ -0,0 +1,135 @@
+
+#include "arinc429/label_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct sdi : eld::arinc429::data_descriptor<sdi, 9, 10, uint8_t>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, int32_t>
+    {
+    };
+
+    using data_word_t = eld::arinc429::word_generic<label, sdi, data>;
+
+    eld::arinc429::traits::word_raw_type make_word(uint8_t labelValue,
+                                                   int32_t dataValue,
+                                                   uint8_t sdiValue = 0)
+    {
+        data_word_t word{ 0 };
+        word.set<label>(labelValue);
+        word.set<sdi>(sdiValue);
+        word.set<data>(dataValue);
+        return word.get_raw();
+    }
+}
+
+TEST(LabelCacheTests, UpdateAndGet)
+{
+    eld::arinc429::label_cache<eld::arinc429::label_word<0312, data_word_t>,
+                               eld::arinc429::label_word<0162, data_word_t>>
+        cache;
+
+    data_word_t word{ 0 };
+    EXPECT_FALSE(cache.get<0312>(word));
+
+    EXPECT_TRUE(cache.update(make_word(0312, -5)));
+    EXPECT_FALSE(cache.update(make_word(0100, 7)));
+    EXPECT_TRUE(cache.update(make_word(0312, 6)));
+
+    ASSERT_TRUE(cache.get<0312>(word));
+    EXPECT_EQ(6, word.get<data>());
+    EXPECT_FALSE(cache.get<0162>(word));
+
+    eld::arinc429::traits::word_raw_type wordRaw = 0;
+    EXPECT_FALSE(cache.get_raw(0100, wordRaw));
+}
+
+TEST(LabelCacheTests, ChangedMask)
+{
+    using cache_t = eld::arinc429::label_cache<eld::arinc429::label_word<0312, data_word_t>,
+                                               eld::arinc429::label_word<0162, data_word_t>>;
+    static_assert(cache_t::mask_size() == 4, "256 bits are expected!");
+    cache_t cache;
+
+    const eld::arinc429::traits::word_raw_type words[]{ make_word(0312, 1),
+                                                        make_word(0162, 2) };
+    EXPECT_EQ(2u, cache.update(words, 2));
+
+    uint64_t changed[cache_t::mask_size()]{};
+    cache.take_changed(changed);
+    EXPECT_EQ(uint64_t(1) << (0312 - 192), changed[3]);
+    EXPECT_EQ(uint64_t(1) << (0162 - 64), changed[1]);
+
+    // same word is not a change
+    cache.update(make_word(0312, 1));
+    cache.take_changed(changed);
+    EXPECT_EQ(0u, changed[1] | changed[3]);
+
+    cache.update(make_word(0162, 3));
+    cache.take_changed(changed);
+    EXPECT_EQ(0u, changed[3]);
+    EXPECT_EQ(uint64_t(1) << (0162 - 64), changed[1]);
+}
+
+TEST(LabelCacheTests, SlotPerSdi)
+{
+    using cache_t = eld::arinc429::sdi_label_cache<eld::arinc429::label_word<0312, data_word_t>>;
+    static_assert(cache_t::slots_count() == 1024, "A slot per label and SDI is expected!");
+    cache_t cache;
+
+    cache.update(make_word(0312, 10, 1));
+    cache.update(make_word(0312, 30, 3));
+
+    data_word_t word{ 0 };
+    EXPECT_FALSE(cache.get<0312>(word, 0));
+    ASSERT_TRUE(cache.get<0312>(word, 1));
+    EXPECT_EQ(10, word.get<data>());
+    ASSERT_TRUE(cache.get<0312>(word, 3));
+    EXPECT_EQ(30, word.get<data>());
+
+    uint64_t changed[cache_t::mask_size()]{};
+    cache.take_changed(changed);
+    EXPECT_EQ(uint64_t(1) << (0312 % 64), changed[(0312 + 256) / 64]);
+    EXPECT_EQ(uint64_t(1) << (0312 % 64), changed[(0312 + 768) / 64]);
+}
+
+TEST(LabelCacheTests, ConsistentSnapshot)
+{
+    using cache_t = eld::arinc429::label_cache<eld::arinc429::label_word<0312, data_word_t>,
+                                               eld::arinc429::label_word<0162, data_word_t>>;
+    auto cache = std::make_unique<cache_t>();
+
+    constexpr int32_t count = 20000;
+    std::thread writer([&cache] {
+        for (int32_t i = 1; i <= count; ++i)
+        {
+            const eld::arinc429::traits::word_raw_type words[]{ make_word(0312, i),
+                                                                make_word(0162, i) };
+            cache->update(words, 2);
+        }
+    });
+
+    bool consistent = true;
+    int32_t last = 0;
+    auto snapshot = std::make_unique<cache_t::snapshot_type>();
+    while (last != count)
+    {
+        cache->snapshot(*snapshot);
+        const int32_t first = data_word_t(snapshot->words[0312]).get<data>();
+        const int32_t second = data_word_t(snapshot->words[0162]).get<data>();
+        consistent = consistent && first == second && first >= last;
+        last = first;
+    }
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+}
@@ -0,0 +1,183 @@
+
+#include "arinc429/multi_word.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct sdi : eld::arinc429::data_descriptor<sdi, 9, 10, uint8_t>
+    {
+    };
+    struct high : eld::arinc429::data_descriptor<high, 11, 29, uint32_t>
+    {
+    };
+    struct low : eld::arinc429::data_descriptor<low, 11, 26, uint32_t>
+    {
+    };
+    struct state_matrix : eld::arinc429::data_descriptor<state_matrix, 30, 31, uint8_t>
+    {
+    };
+
+    using high_word_t = eld::arinc429::word_generic<label, sdi, high, state_matrix>;
+    using low_word_t = eld::arinc429::word_generic<label, sdi, low, state_matrix>;
+
+    template<typename ValueT, typename ScaleFactorT, uint8_t HighLabel, uint8_t LowLabel>
+    using position_t =
+        eld::arinc429::multi_word<ValueT,
+                                  ScaleFactorT,
+                                  eld::arinc429::multi_word_part<HighLabel, high_word_t, high>,
+                                  eld::arinc429::multi_word_part<LowLabel, low_word_t, low>>;
+
+    using latitude_t = position_t<double, std::ratio<180, (int64_t(1) << 34)>, 0110, 0120>;
+    using longitude_t = position_t<double, std::ratio<180, (int64_t(1) << 34)>, 0111, 0121>;
+    using counter_t = position_t<uint64_t, std::ratio<1>, 0112, 0122>;
+
+    eld::arinc429::traits::word_raw_type make_word(uint8_t labelValue,
+                                                   uint8_t sdiValue,
+                                                   uint32_t dataValue)
+    {
+        high_word_t word{ 0 };
+        word.set_all(labelValue, sdiValue, dataValue, uint8_t(3));
+        return word.get_raw();
+    }
+
+    struct handler
+    {
+        void operator()(const latitude_t &latitude)
+        {
+            latitudes.push_back(latitude.get());
+            sdis.push_back(latitude.word<0>().get<sdi>());
+        }
+
+        void operator()(const longitude_t &longitude) { longitudes.push_back(longitude.get()); }
+
+        void operator()(const counter_t &counter) { counters.push_back(counter.get()); }
+
+        std::vector<double> latitudes;
+        std::vector<uint8_t> sdis;
+        std::vector<double> longitudes;
+        std::vector<uint64_t> counters;
+    };
+}
+
+TEST(MultiWordTests, EncodeDecode)
+{
+    static_assert(latitude_t::width() == 35, "");
+    static_assert(latitude_t::parts_count() == 2, "");
+    static_assert(latitude_t::label(1) == 0120, "");
+
+    const double resolution = 180.0 / double(int64_t(1) << 34);
+    eld::arinc429::traits::word_raw_type words[]{ make_word(0110, 2, 0), make_word(0120, 2, 0) };
+
+    for (const double value : { 0.0, 45.123456789, -45.123456789, 179.99, -180.0 })
+    {
+        latitude_t::encode(value, words);
+        EXPECT_NEAR(value, latitude_t::decode(words), resolution);
+
+        // bits outside of the parts are kept
+        EXPECT_EQ(0110u, (eld::arinc429::detail::bit_field<1, 8>::extract(words[0])));
+        EXPECT_EQ(0120u, (eld::arinc429::detail::bit_field<1, 8>::extract(words[1])));
+        EXPECT_EQ(0x60000200u, words[0] & 0xe0000300u);
+        EXPECT_EQ(0x60000200u, words[1] & 0xfc000300u);
+    }
+
+    // the first part is the most significant
+    counter_t counter{};
+    counter.set(0x5123456789);
+    EXPECT_EQ(0x12345u, counter.word<0>().get<high>());
+    EXPECT_EQ(0x6789u, counter.word<1>().get<low>());
+    EXPECT_EQ(uint64_t(0x5123456789) & ((uint64_t(1) << 35) - 1), counter.get());
+
+    using signed_t = position_t<int64_t, std::ratio<1>, 0112, 0122>;
+    signed_t signedValue{};
+    signedValue.set(-3);
+    EXPECT_EQ(-3, signedValue.get());
+    EXPECT_EQ(0x7ffffu, signedValue.word<0>().get<high>());
+}
+
+TEST(MultiWordTests, FullWidth)
+{
+    struct all : eld::arinc429::data_descriptor<all, 1, 32, uint32_t>
+    {
+    };
+    using word_t = eld::arinc429::word_generic<all>;
+    using value_t = eld::arinc429::multi_word<int64_t,
+                                              std::ratio<1>,
+                                              eld::arinc429::multi_word_part<1, word_t, all>,
+                                              eld::arinc429::multi_word_part<2, word_t, all>>;
+
+    const eld::arinc429::traits::word_raw_type words[]{ 0x80000000, 0x00000001 };
+    EXPECT_EQ(std::numeric_limits<int64_t>::min() + 1, value_t::decode(words));
+}
+
+TEST(MultiWordTests, AssemblePairs)
+{
+    eld::arinc429::multi_word_assembler<latitude_t, longitude_t, counter_t> assembler;
+    handler results;
+
+    const eld::arinc429::traits::word_raw_type latitudeWords[]{ make_word(0110, 0, 0),
+                                                                make_word(0120, 0, 0) };
+    const eld::arinc429::traits::word_raw_type longitudeWords[]{ make_word(0111, 0, 0),
+                                                                 make_word(0121, 0, 0) };
+    latitude_t latitude(latitudeWords);
+    latitude.set(51.4775);
+    longitude_t longitude(longitudeWords);
+    longitude.set(-0.461389);
+
+    const eld::arinc429::traits::word_raw_type words[]{
+        latitude.get_raw(0),
+        make_word(0312, 0, 7),   // unbound
+        longitude.get_raw(0),
+        latitude.get_raw(1),
+        longitude.get_raw(1),
+        make_word(0122, 0, 1),   // out of order
+        make_word(0112, 0, 1),
+        make_word(0112, 0, 2),   // restarts
+        make_word(0122, 0, 3),
+    };
+    EXPECT_EQ(3u, assembler.push(words, sizeof(words) / sizeof(words[0]), results));
+
+    ASSERT_EQ(1u, results.latitudes.size());
+    EXPECT_DOUBLE_EQ(latitude.get(), results.latitudes[0]);
+    ASSERT_EQ(1u, results.longitudes.size());
+    EXPECT_DOUBLE_EQ(longitude.get(), results.longitudes[0]);
+    ASSERT_EQ(1u, results.counters.size());
+    EXPECT_EQ((uint64_t(2) << 16) | 3u, results.counters[0]);
+
+    // a part after the last one does not complete a parameter
+    EXPECT_FALSE(assembler.push(make_word(0122, 0, 3), results));
+
+    // reset discards pending parts
+    EXPECT_FALSE(assembler.push(make_word(0112, 0, 4), results));
+    assembler.reset();
+    EXPECT_FALSE(assembler.push(make_word(0122, 0, 5), results));
+    EXPECT_EQ(1u, results.counters.size());
+}
+
+TEST(MultiWordTests, AssemblePerSdi)
+{
+    eld::arinc429::sdi_multi_word_assembler<latitude_t> assembler;
+    handler results;
+
+    const eld::arinc429::traits::word_raw_type words[]{
+        make_word(0110, 1, 0x00010), make_word(0110, 2, 0x00020), make_word(0120, 2, 0x0002),
+        make_word(0120, 1, 0x0001),  make_word(0120, 3, 0x0003),
+    };
+    EXPECT_EQ(2u, assembler.push(words, sizeof(words) / sizeof(words[0]), results));
+
+    ASSERT_EQ(2u, results.sdis.size());
+    EXPECT_EQ(2u, results.sdis[0]);
+    EXPECT_EQ(1u, results.sdis[1]);
+
+    // a parameter per label mixes sources
+    eld::arinc429::multi_word_assembler<latitude_t> mixed;
+    EXPECT_EQ(1u, mixed.push(words, 3, results));
+    EXPECT_EQ(2u, results.sdis.back());
+    ASSERT_EQ(3u, results.latitudes.size());
+    EXPECT_EQ(results.latitudes[0], results.latitudes[2]);
+}
@@ -0,0 +1,113 @@
+
+#include "arinc429/replay.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 9, 29, int32_t>
+    {
+    };
+    struct angle : eld::arinc429::data_descriptor<angle, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    struct status : eld::arinc429::discrete_descriptor<status, 30>
+    {
+    };
+
+    using data_word_t = eld::arinc429::word_generic<label, data, status>;
+
+    /**
+     * Two channels with out of order timestamps, every third record has other label.
+     */
+    std::vector<eld::arinc429::capture_record> make_records(size_t count)
+    {
+        std::vector<eld::arinc429::capture_record> records(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            data_word_t word{ 0 };
+            word.set<label>(uint8_t(i % 3 ? 0312 : 0162));
+            word.set<data>(int32_t(i) - int32_t(count / 2));
+            word.set<status>(i % 2 == 0);
+
+            records[i].word = word.get_raw();
+            records[i].channel = uint16_t(i % 2);
+            records[i].timestamp = 10 * i + (i % 2 ? 0 : 25);
+        }
+        return records;
+    }
+}
+
+TEST(ReplayTests, DecodeInTimestampOrder)
+{
+    const auto records = make_records(10000);
+    const eld::arinc429::capture_view view(records.data(), records.size());
+
+    std::vector<eld::arinc429::replay_sample<data_word_t, data, status>> expected;
+    for (const auto &record : records)
+    {
+        data_word_t word(record.word);
+        if (word.get<label>() == 0312)
+        {
+            expected.push_back({ record.timestamp,
+                                 record.channel,
+                                 std::make_tuple(int32_t(word.get<data>()),
+                                                 bool(word.get<status>())) });
+        }
+    }
+    std::stable_sort(expected.begin(), expected.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.timestamp < rhs.timestamp;
+    });
+
+    for (const size_t threads : { 1, 4, 7 })
+    {
+        const eld::arinc429::replay_engine engine(threads, 333);
+        EXPECT_EQ(threads, engine.threads_count());
+
+        const auto samples = engine.decode<data_word_t, data, status>(view, 0312);
+        ASSERT_EQ(expected.size(), samples.size());
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            EXPECT_EQ(expected[i].timestamp, samples[i].timestamp);
+            EXPECT_EQ(expected[i].channel, samples[i].channel);
+            EXPECT_EQ(expected[i].values, samples[i].values);
+        }
+    }
+}
+
+TEST(ReplayTests, ReplayHandler)
+{
+    using angle_word_t = eld::arinc429::word_generic<label, angle>;
+
+    std::vector<eld::arinc429::capture_record> records(100);
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        angle_word_t word{ 0 };
+        word.set<label>(uint8_t(0162));
+        word.set<angle>(double(i));
+        records[i].word = word.get_raw();
+        records[i].timestamp = records.size() - i;
+    }
+
+    const eld::arinc429::replay_engine engine(3, 10);
+    std::vector<uint64_t> timestamps;
+    engine.replay<angle_word_t, angle>(
+        eld::arinc429::capture_view(records.data(), records.size()),
+        0162,
+        [&](const eld::arinc429::replay_sample<angle_word_t, angle> &sample) {
+            timestamps.push_back(sample.timestamp);
+            angle_word_t word(records[records.size() - sample.timestamp].word);
+            EXPECT_EQ(word.get<angle>(), std::get<0>(sample.values));
+        });
+
+    ASSERT_EQ(records.size(), timestamps.size());
+    EXPECT_TRUE(std::is_sorted(timestamps.begin(), timestamps.end()));
+
+    const auto empty = engine.decode<angle_word_t, angle>(eld::arinc429::capture_view(), 0162);
+    EXPECT_TRUE(empty.empty());
+}
@@ -0,0 +1,155 @@
+
+#include "arinc429/batch.h"
+#include "arinc429/ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(RingBufferTests, PushAndPop)
+{
+    eld::arinc429::spsc_ring<4> ring;
+    EXPECT_TRUE(ring.empty());
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.push(i));
+    }
+    EXPECT_FALSE(ring.push(4));
+    EXPECT_EQ(4u, ring.size());
+
+    eld::arinc429::traits::word_raw_type word = 0;
+    EXPECT_TRUE(ring.pop(word));
+    EXPECT_EQ(0u, word);
+
+    // wrap around the end of storage
+    const eld::arinc429::traits::word_raw_type words[]{ 10, 11, 12 };
+    EXPECT_EQ(1u, ring.push_n(words, 3));
+
+    eld::arinc429::traits::word_raw_type out[8]{};
+    EXPECT_EQ(4u, ring.pop_n(out, 8));
+    EXPECT_EQ(1u, out[0]);
+    EXPECT_EQ(2u, out[1]);
+    EXPECT_EQ(3u, out[2]);
+    EXPECT_EQ(10u, out[3]);
+    EXPECT_FALSE(ring.pop(word));
+}
+
+TEST(RingBufferTests, Timestamps)
+{
+    eld::arinc429::spsc_ring<8, uint64_t> ring;
+
+    const eld::arinc429::traits::word_raw_type words[]{ 1, 2, 3 };
+    const uint64_t timestamps[]{ 100, 200, 300 };
+    EXPECT_EQ(3u, ring.push_n(words, timestamps, 3));
+    EXPECT_TRUE(ring.push(4, uint64_t(400)));
+
+    eld::arinc429::traits::word_raw_type word = 0;
+    uint64_t timestamp = 0;
+    EXPECT_TRUE(ring.pop(word, timestamp));
+    EXPECT_EQ(1u, word);
+    EXPECT_EQ(100u, timestamp);
+
+    eld::arinc429::traits::word_raw_type outWords[3]{};
+    uint64_t outTimestamps[3]{};
+    EXPECT_EQ(3u, ring.pop_n(outWords, outTimestamps, 3));
+    EXPECT_EQ(4u, outWords[2]);
+    EXPECT_EQ(400u, outTimestamps[2]);
+}
+
+TEST(RingBufferTests, ConsumeInPlace)
+{
+    struct data : eld::arinc429::data_descriptor<data, 9, 29, int32_t>
+    {
+    };
+
+    eld::arinc429::spsc_ring<16> ring;
+    std::vector<eld::arinc429::traits::word_raw_type> rawWords;
+    for (int32_t i = -6; i < 6; ++i)
+    {
+        eld::arinc429::traits::word_raw_type rawWord = 0;
+        eld::arinc429::set_value<data>(i, rawWord);
+        rawWords.push_back(rawWord);
+    }
+
+    // move the indices so that consumed words wrap around the end of storage
+    ring.push_n(rawWords.data(), 10);
+    ring.consume(10, [](const eld::arinc429::traits::word_raw_type *, size_t) {});
+    ASSERT_EQ(rawWords.size(), ring.push_n(rawWords.data(), rawWords.size()));
+
+    std::vector<int32_t> values;
+    size_t blocks = 0;
+    const auto consumed =
+        ring.consume(rawWords.size(), [&](const eld::arinc429::traits::word_raw_type *in, size_t n) {
+            std::vector<int32_t> block(n);
+            eld::arinc429::decode_batch<data>(in, n, block.data());
+            values.insert(values.end(), block.begin(), block.end());
+            ++blocks;
+        });
+
+    EXPECT_EQ(rawWords.size(), consumed);
+    EXPECT_EQ(2u, blocks);
+    ASSERT_EQ(rawWords.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(int32_t(i) - 6, values[i]);
+    }
+}
+
+TEST(RingBufferTests, ProducerAndConsumerThreads)
+{
+    constexpr uint32_t count = 200000;
+    auto ring = std::make_unique<eld::arinc429::spsc_ring<1024>>();
+
+    std::thread producer([&ring] {
+        eld::arinc429::traits::word_raw_type words[64];
+        uint32_t next = 0;
+        while (next < count)
+        {
+            const uint32_t n = std::min<uint32_t>(64, count - next);
+            for (uint32_t i = 0; i < n; ++i)
+            {
+                words[i] = next + i;
+            }
+            size_t pushed = 0;
+            while (pushed < n)
+            {
+                pushed += ring->push_n(words + pushed, n - pushed);
+            }
+            next += n;
+        }
+    });
+
+    // size observed by a third thread, e.g. a stealing worker, stays within the capacity
+    std::atomic<bool> done{ false };
+    bool bounded = true;
+    std::thread observer([&] {
+        while (!done.load())
+        {
+            bounded = bounded && ring->size() <= ring->capacity();
+        }
+    });
+
+    uint32_t expected = 0;
+    bool ordered = true;
+    while (expected < count)
+    {
+        ring->consume(100, [&](const eld::arinc429::traits::word_raw_type *in, size_t n) {
+            for (size_t i = 0; i < n; ++i)
+            {
+                ordered = ordered && in[i] == expected;
+                ++expected;
+            }
+        });
+    }
+    producer.join();
+    done.store(true);
+    observer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(bounded);
+    EXPECT_TRUE(ring->empty());
+}
@@ -0,0 +1,114 @@
+
+#include "arinc429/runtime_layout.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    std::vector<eld::arinc429::runtime_field> make_fields()
+    {
+        using eld::arinc429::runtime_field_type;
+        return { { "SSM", 30, 31, runtime_field_type::unsigned_integral, 1.0 },
+                 { "LABEL", 1, 8, runtime_field_type::unsigned_integral, 1.0 },
+                 { "ANGLE", 18, 29, runtime_field_type::floating_point, 0.088 },
+                 { "DELTA", 9, 17, runtime_field_type::signed_integral, 1.0 } };
+    }
+
+    std::vector<eld::arinc429::traits::word_raw_type> make_raw_words(size_t count)
+    {
+        std::vector<eld::arinc429::traits::word_raw_type> rawWords(count);
+        uint32_t state = 0xf3f21872;
+        for (auto &rawWord : rawWords)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            rawWord = state;
+        }
+        return rawWords;
+    }
+
+    double runtime_get_value(const eld::arinc429::runtime_field &field,
+                             eld::arinc429::traits::word_raw_type rawWord)
+    {
+        switch (field.type)
+        {
+            case eld::arinc429::runtime_field_type::unsigned_integral:
+            {
+                uint32_t value = 0;
+                eld::arinc429::get_value(value, rawWord, field.lsb, field.msb);
+                return value;
+            }
+            case eld::arinc429::runtime_field_type::signed_integral:
+            {
+                int32_t value = 0;
+                eld::arinc429::get_value(value, rawWord, field.lsb, field.msb);
+                return value;
+            }
+            default:
+            {
+                double value = 0;
+                eld::arinc429::get_value(value, rawWord, field.lsb, field.msb, field.scale_factor);
+                return value;
+            }
+        }
+    }
+}
+
+TEST(RuntimeLayoutTests, Validate)
+{
+    using eld::arinc429::runtime_field_type;
+
+    EXPECT_TRUE(eld::arinc429::runtime_word_layout(make_fields()).valid());
+    EXPECT_TRUE(eld::arinc429::runtime_word_layout().valid());
+
+    EXPECT_FALSE(eld::arinc429::runtime_word_layout(
+                     { { "A", 1, 8, runtime_field_type::unsigned_integral, 1.0 },
+                       { "B", 8, 9, runtime_field_type::unsigned_integral, 1.0 } })
+                     .valid());
+    EXPECT_FALSE(eld::arinc429::runtime_word_layout(
+                     { { "A", 0, 8, runtime_field_type::unsigned_integral, 1.0 } })
+                     .valid());
+    EXPECT_FALSE(eld::arinc429::runtime_word_layout(
+                     { { "A", 30, 33, runtime_field_type::unsigned_integral, 1.0 } })
+                     .valid());
+}
+
+TEST(RuntimeLayoutTests, SameAsRuntimeGetValue)
+{
+    const eld::arinc429::runtime_word_layout layout(make_fields());
+    ASSERT_EQ(4u, layout.size());
+    EXPECT_EQ(2u, layout.find("ANGLE"));
+    EXPECT_EQ(layout.size(), layout.find("HEADING"));
+
+    const auto rawWords = make_raw_words(1000);
+    std::vector<double> rows(rawWords.size() * layout.size());
+    layout.decode_batch(rawWords.data(), rawWords.size(), rows.data());
+
+    std::vector<std::vector<double>> columns(layout.size(), std::vector<double>(rawWords.size()));
+    std::vector<double *> columnPointers;
+    for (auto &column : columns)
+    {
+        columnPointers.push_back(column.data());
+    }
+    layout.decode_soa(rawWords.data(), rawWords.size(), columnPointers.data());
+
+    for (size_t i = 0; i < rawWords.size(); ++i)
+    {
+        for (size_t field = 0; field < layout.size(); ++field)
+        {
+            const double expected = runtime_get_value(layout.fields()[field], rawWords[i]);
+            EXPECT_EQ(expected, rows[i * layout.size() + field]);
+            EXPECT_EQ(expected, columns[field][i]);
+        }
+    }
+
+    double values[4]{};
+    layout.decode(0xf3f21872, values);
+    EXPECT_EQ(3, values[0]);
+    EXPECT_EQ(0162, values[1]);
+    EXPECT_EQ(-135.78399999999999, values[2]);
+    EXPECT_EQ(24, values[3]);
+}
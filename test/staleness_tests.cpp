@@ -0,0 +1,144 @@
+
+#include "arinc429/staleness.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, int32_t>
+    {
+    };
+
+    using data_word_t = eld::arinc429::word_generic<label, data>;
+
+    eld::arinc429::traits::word_raw_type make_word(uint8_t labelValue)
+    {
+        data_word_t word{ 0 };
+        word.set<label>(labelValue);
+        return word.get_raw();
+    }
+
+    struct recording_handler
+    {
+        void operator()(const eld::arinc429::staleness_event &event) { events.push_back(event); }
+
+        std::vector<eld::arinc429::staleness_event> events;
+    };
+}
+
+TEST(StalenessTests, Transitions)
+{
+    eld::arinc429::staleness_monitor<eld::arinc429::label_rate<0312, data_word_t, 10>> monitor(1);
+    recording_handler handler;
+
+    monitor.advance(9, handler);
+    EXPECT_TRUE(handler.events.empty());
+    monitor.advance(10, handler);
+    ASSERT_EQ(1u, handler.events.size());
+    EXPECT_EQ(10u, handler.events[0].time);
+    EXPECT_EQ(0u, handler.events[0].channel);
+    EXPECT_EQ(0312u, handler.events[0].label);
+    EXPECT_TRUE(handler.events[0].stale);
+    EXPECT_TRUE(monitor.is_stale(0, 0312));
+
+    // only transitions are reported
+    monitor.advance(100, handler);
+    EXPECT_EQ(1u, handler.events.size());
+
+    EXPECT_TRUE(monitor.received(0, make_word(0312), handler));
+    ASSERT_EQ(2u, handler.events.size());
+    EXPECT_EQ(100u, handler.events[1].time);
+    EXPECT_FALSE(handler.events[1].stale);
+    EXPECT_FALSE(monitor.is_stale(0, 0312));
+
+    EXPECT_TRUE(monitor.received(0, make_word(0312), handler));
+    EXPECT_FALSE(monitor.received(0, make_word(0100), handler));
+    EXPECT_EQ(2u, handler.events.size());
+
+    monitor.advance(109, handler);
+    EXPECT_EQ(2u, handler.events.size());
+    monitor.advance(110, handler);
+    ASSERT_EQ(3u, handler.events.size());
+    EXPECT_EQ(110u, handler.events[2].time);
+    EXPECT_TRUE(handler.events[2].stale);
+}
+
+TEST(StalenessTests, WordsWithinTimeout)
+{
+    eld::arinc429::staleness_monitor<eld::arinc429::label_rate<0312, data_word_t, 10>> monitor(1,
+                                                                                                 50);
+    recording_handler handler;
+
+    for (uint64_t time = 50; time < 5000; time += 7)
+    {
+        monitor.advance(time, handler);
+        monitor.received(0, make_word(0312), handler);
+    }
+    EXPECT_TRUE(handler.events.empty());
+
+    // last word at 4999
+    monitor.advance(5008, handler);
+    EXPECT_TRUE(handler.events.empty());
+    monitor.advance(5009, handler);
+    ASSERT_EQ(1u, handler.events.size());
+    EXPECT_EQ(5009u, handler.events[0].time);
+}
+
+TEST(StalenessTests, LongTimeouts)
+{
+    // deadlines at the second level, the top level and beyond the wheel
+    eld::arinc429::staleness_monitor<eld::arinc429::label_rate<1, data_word_t, 4000>,
+                                     eld::arinc429::label_rate<2, data_word_t, 300000>,
+                                     eld::arinc429::label_rate<3, data_word_t, 20000000>>
+        monitor(1, 123);
+    recording_handler handler;
+
+    monitor.advance(30000000, handler);
+    ASSERT_EQ(3u, handler.events.size());
+    EXPECT_EQ(4123u, handler.events[0].time);
+    EXPECT_EQ(1u, handler.events[0].label);
+    EXPECT_EQ(300123u, handler.events[1].time);
+    EXPECT_EQ(2u, handler.events[1].label);
+    EXPECT_EQ(20000123u, handler.events[2].time);
+    EXPECT_EQ(3u, handler.events[2].label);
+}
+
+TEST(StalenessTests, Channels)
+{
+    eld::arinc429::staleness_monitor<eld::arinc429::label_rate<0312, data_word_t, 20>,
+                                     eld::arinc429::label_rate<0162, data_word_t, 50>>
+        monitor(3);
+    EXPECT_EQ(3u, monitor.channels_count());
+    recording_handler handler;
+
+    for (uint64_t time = 0; time <= 60; time += 10)
+    {
+        monitor.advance(time, handler);
+        monitor.received(1, make_word(0312), handler);
+        monitor.received(2, make_word(0162), handler);
+    }
+
+    ASSERT_EQ(4u, handler.events.size());
+    EXPECT_EQ(20u, handler.events[0].time);
+    EXPECT_EQ(0u, handler.events[0].channel);
+    EXPECT_EQ(0312u, handler.events[0].label);
+    EXPECT_EQ(20u, handler.events[1].time);
+    EXPECT_EQ(2u, handler.events[1].channel);
+    EXPECT_EQ(0312u, handler.events[1].label);
+    EXPECT_EQ(50u, handler.events[2].time);
+    EXPECT_EQ(0u, handler.events[2].channel);
+    EXPECT_EQ(0162u, handler.events[2].label);
+    EXPECT_EQ(50u, handler.events[3].time);
+    EXPECT_EQ(1u, handler.events[3].channel);
+    EXPECT_EQ(0162u, handler.events[3].label);
+
+    EXPECT_TRUE(monitor.is_stale(0, 0312));
+    EXPECT_FALSE(monitor.is_stale(1, 0312));
+    EXPECT_FALSE(monitor.is_stale(2, 0162));
+    EXPECT_FALSE(monitor.is_stale(2, 0100));
+}
@@ -587,6 +587,744 @@ TEST(CustomizationTests, CustomizedSetterAndGetter)
     EXPECT_EQ(get_value, set_value);
 }
 
+TEST(SetAndGetWordTests, SetAllAndGetAll)
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data_0 : eld::arinc429::data_descriptor<data_0, 11, 13, uint8_t>
+    {
+    };
+    struct data_1 : eld::arinc429::data_descriptor<data_1, 14, 15, uint8_t>
+    {
+    };
+    struct data_2 : eld::arinc429::data_descriptor<data_2, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    struct state_matrix : eld::arinc429::data_descriptor<state_matrix, 30, 31, uint8_t>
+    {
+    };
+    struct parity : eld::arinc429::data_descriptor<parity, 32, 32, uint8_t>
+    {
+    };
+
+    using word_with_label_t =
+        eld::arinc429::word_generic<label, data_0, data_1, data_2, state_matrix, parity>;
+
+    constexpr uint8_t exp_label = 0162;
+    constexpr uint8_t exp_data_0 = 6;
+    constexpr uint8_t exp_data_1 = 0;
+    constexpr double exp_data_2 = -135.78399999999999;
+    constexpr uint8_t exp_state_matrix = 3;
+    constexpr uint8_t exp_parity = 1;
+
+    word_with_label_t wordWithLabel{ 0 };
+    wordWithLabel.set_all(exp_label,
+                          exp_data_0,
+                          exp_data_1,
+                          exp_data_2,
+                          exp_state_matrix,
+                          exp_parity);
+
+    EXPECT_EQ(0xf3f21872, wordWithLabel.get_raw());
+
+    const auto values = wordWithLabel.get_all();
+    EXPECT_EQ(exp_label, std::get<0>(values));
+    EXPECT_EQ(exp_data_0, std::get<1>(values));
+    EXPECT_EQ(exp_data_1, std::get<2>(values));
+    EXPECT_EQ(exp_data_2, std::get<3>(values));
+    EXPECT_EQ(exp_state_matrix, std::get<4>(values));
+    EXPECT_EQ(exp_parity, std::get<5>(values));
+
+    // bits 9-10 and 16-17 are not covered by any data and must be preserved
+    constexpr uint32_t undefined_bits = 0x00018300;
+    word_with_label_t otherWord{ 0xffffffff };
+    otherWord.set_from(values);
+
+    EXPECT_EQ(0xf3f21872 | undefined_bits, otherWord.get_raw());
+}
+
+TEST(CustomizationTests, ReversedLabel)
+{
+    struct label : eld::arinc429::label_descriptor<label>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 9, 29, uint32_t>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, data>;
+
+    word_t word{ 0xf3f21872 };
+    EXPECT_EQ(0116, word.get<label>());
+
+    word.set<label>(uint8_t(0162));
+    EXPECT_EQ(0xf3f2184e, word.get_raw());
+    EXPECT_EQ(0162, word.get<label>());
+}
+
+TEST(CustomizationTests, ReverseBitsTable)
+{
+    static_assert(eld::arinc429::detail::reverse_bits(0x01) == 0x80, "");
+    static_assert(eld::arinc429::detail::reverse_bits(0x72) == 0x4e, "");
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+        const auto value = uint8_t(i);
+        uint8_t expected = 0;
+        for (size_t bit = 0; bit < 8; ++bit)
+        {
+            expected |= uint8_t(((value >> bit) & 1) << (7 - bit));
+        }
+        EXPECT_EQ(expected, eld::arinc429::detail::reverse_bits(value));
+    }
+}
+
+TEST(ParityTests, ComputeAndValidate)
+{
+    static_assert(eld::arinc429::compute_parity(0x73f21872) == 1, "");
+    static_assert(eld::arinc429::compute_parity(0xf3f21873) == 0, "");
+    static_assert(eld::arinc429::validate_parity(0xf3f21872), "");
+    static_assert(!eld::arinc429::validate_parity(0x73f21872), "");
+    static_assert(!eld::arinc429::validate_parity(0), "");
+
+    for (uint32_t bit = 0; bit < 32; ++bit)
+    {
+        EXPECT_TRUE(eld::arinc429::validate_parity(uint32_t(1) << bit));
+        EXPECT_FALSE(eld::arinc429::validate_parity(0xf3f21872 ^ (uint32_t(1) << bit)));
+    }
+}
+
+TEST(ParityTests, FinalizeWord)
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data_2 : eld::arinc429::data_descriptor<data_2, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    struct state_matrix : eld::arinc429::data_descriptor<state_matrix, 30, 31, uint8_t>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, data_2, state_matrix>;
+
+    word_t word{ 0x73f21872 };
+    word.finalize();
+    EXPECT_EQ(0xf3f21872, word.get_raw());
+
+    word.set<label>(uint8_t(0163));
+    word.finalize();
+    EXPECT_EQ(0x73f21873u, word.get_raw());
+    EXPECT_TRUE(eld::arinc429::validate_parity(word.get_raw()));
+}
+
+TEST(EncodingTests, BnrData)
+{
+    struct data_2 : eld::arinc429::bnr_descriptor<data_2, 11, std::ratio<88, 1000>>
+    {
+    };
+    struct heading :
+      eld::arinc429::bnr_descriptor<heading, 12, eld::arinc429::bnr_resolution_t<std::ratio<180>, 12>>
+    {
+    };
+
+    static_assert(data_2::lsb() == 18 && data_2::msb() == 29, "");
+    static_assert(heading::lsb() == 17, "");
+
+    eld::arinc429::word_generic<data_2> word{ 0xf3f21872 };
+    EXPECT_EQ(-135.78399999999999, word.get<data_2>());
+
+    eld::arinc429::word_generic<heading> headingWord{ 0 };
+    headingWord.set<heading>(-90.);
+    EXPECT_EQ(-90., headingWord.get<heading>());
+    EXPECT_EQ(0x18000000u, headingWord.get_raw());
+}
+
+TEST(EncodingTests, BcdData)
+{
+    struct data : eld::arinc429::bcd_descriptor<data, 11, 29>
+    {
+    };
+    struct state_matrix : eld::arinc429::data_descriptor<state_matrix, 30, 31, uint8_t>
+    {
+    };
+
+    static_assert(data::digits() == 5, "");
+
+    using word_t = eld::arinc429::word_generic<data, state_matrix>;
+
+    word_t word{ 0 };
+    word.set<state_matrix>(uint8_t(3));
+    word.set<data>(12345u);
+    EXPECT_EQ(0x60000000u | (0x12345u << 10), word.get_raw());
+    EXPECT_EQ(12345u, word.get<data>());
+    EXPECT_EQ(3, word.get<state_matrix>());
+
+    word.set<data>(79999u);
+    EXPECT_EQ(79999u, word.get<data>());
+
+    // most significant digit is 3 bits wide
+    word.set<data>(80000u);
+    EXPECT_EQ(0u, word.get<data>());
+}
+
+TEST(EncodingTests, DiscreteData)
+{
+    struct flag_0 : eld::arinc429::discrete_descriptor<flag_0, 11>
+    {
+    };
+    struct flag_1 : eld::arinc429::discrete_descriptor<flag_1, 12>
+    {
+    };
+
+    eld::arinc429::word_generic<flag_0, flag_1> word{ 0 };
+    word.set<flag_1>(true);
+    EXPECT_FALSE(word.get<flag_0>());
+    EXPECT_TRUE(word.get<flag_1>());
+    EXPECT_EQ(0x800u, word.get_raw());
+}
+
+TEST(DefinedBitsTests, Masks)
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data_2 : eld::arinc429::data_descriptor<data_2, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    struct state_matrix : eld::arinc429::data_descriptor<state_matrix, 30, 31, uint8_t>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, data_2, state_matrix>;
+
+    static_assert(eld::arinc429::traits::defined_bits_mask<word_t>() == 0x7ffe00ff, "");
+    static_assert(eld::arinc429::traits::field_mask<label, word_t>() == 0x000000ff, "");
+    static_assert(eld::arinc429::traits::field_mask<data_2, word_t>() == 0x1ffe0000, "");
+    static_assert(eld::arinc429::traits::field_mask<state_matrix, word_t>() == 0x60000000, "");
+
+    static_assert(eld::arinc429::detail::descriptors_masks<std::tuple<label, data_2>>::disjoint(),
+                  "");
+    static_assert(
+        eld::arinc429::detail::descriptors_masks<std::tuple<data_2, state_matrix, label>>::
+            disjoint(),
+        "");
+
+    struct overlapping : eld::arinc429::data_descriptor<overlapping, 29, 30, uint8_t>
+    {
+    };
+    static_assert(
+        !eld::arinc429::detail::descriptors_masks<std::tuple<data_2, overlapping>>::disjoint(),
+        "");
+    static_assert(
+        !eld::arinc429::detail::descriptors_masks<std::tuple<overlapping, state_matrix>>::
+            disjoint(),
+        "");
+}
+
+TEST(DefinedBitsTests, ValidateAndClearUndefined)
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data_2 : eld::arinc429::data_descriptor<data_2, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, data_2>;
+
+    static_assert(word_t{ 0x1ffe00ff }.validate(), "");
+    static_assert(!word_t{ 0x1ffe01ff }.validate(), "");
+
+    word_t word{ 0xf3f21872 };
+    EXPECT_FALSE(word.validate());
+    word.clear_undefined();
+    EXPECT_TRUE(word.validate());
+    EXPECT_EQ(0x13f20072u, word.get_raw());
+
+    // set_all keeps undefined bits
+    word.set_raw(0x80000100);
+    word.set_all(uint8_t(0162), -135.784);
+    EXPECT_EQ(0x93f20172u, word.get_raw());
+}
+
+TEST(DescriptorLookupTests, FindByName)
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data_2 : eld::arinc429::data_descriptor<data_2, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    struct missing
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, data_2>;
+
+    static_assert(
+        std::is_same<eld::arinc429::traits::get_data_descriptor_t<label, word_t>, label>(), "");
+    static_assert(
+        std::is_same<eld::arinc429::traits::get_data_descriptor_t<data_2, word_t>, data_2>(), "");
+    static_assert(
+        std::is_same<eld::arinc429::traits::get_data_descriptor_t<missing, word_t, missing>,
+                     missing>(),
+        "");
+    static_assert(eld::arinc429::traits::are_names_unique<word_t::tuple_descriptors>(), "");
+    static_assert(
+        !eld::arinc429::traits::are_names_unique<std::tuple<label, data_2, label>>(), "");
+}
+
+TEST(ModifierTests, InPlaceMatchesDecodeEncode)
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct counter : eld::arinc429::data_descriptor<counter, 11, 15, uint8_t>
+    {
+    };
+    struct flags : eld::arinc429::data_descriptor<flags, 16, 29, uint16_t>
+    {
+    };
+    struct parity : eld::arinc429::data_descriptor<parity, 32, 32, uint8_t>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, counter, flags, parity>;
+
+    static_assert(eld::arinc429::detail::is_addable_in_place_t<counter>(), "");
+    static_assert(eld::arinc429::detail::is_modifiable_in_place_t<flags>(), "");
+
+    const eld::arinc429::traits::word_raw_type raws[]{ 0, 0xffffffff, 0x9ff07b72, 0x0000f400 };
+    for (const auto raw : raws)
+    {
+        for (const uint8_t operand :
+             { uint8_t(0), uint8_t(1), uint8_t(5), uint8_t(31), uint8_t(200) })
+        {
+            word_t word{ raw };
+            word_t expected{ raw };
+            eld::arinc429::modify<counter>(word) += operand;
+            expected.set<counter>(uint8_t(expected.get<counter>() + operand));
+            EXPECT_EQ(expected.get_raw(), word.get_raw());
+
+            word = word_t{ raw };
+            expected = word_t{ raw };
+            eld::arinc429::modify<counter>(word) -= operand;
+            expected.set<counter>(uint8_t(expected.get<counter>() - operand));
+            EXPECT_EQ(expected.get_raw(), word.get_raw());
+        }
+
+        for (const uint16_t operand : { uint16_t(0), uint16_t(0x2a5), uint16_t(0xffff) })
+        {
+            word_t word{ raw };
+            word_t expected{ raw };
+            eld::arinc429::modify<flags>(word) |= operand;
+            expected.set<flags>(uint16_t(expected.get<flags>() | operand));
+            EXPECT_EQ(expected.get_raw(), word.get_raw());
+
+            word = word_t{ raw };
+            expected = word_t{ raw };
+            eld::arinc429::modify<flags>(word) &= operand;
+            expected.set<flags>(uint16_t(expected.get<flags>() & operand));
+            EXPECT_EQ(expected.get_raw(), word.get_raw());
+        }
+    }
+
+    // wraps around within the field
+    word_t word{ 0 };
+    word.set<counter>(uint8_t(30));
+    eld::arinc429::modify<counter>(word) += uint8_t(5);
+    EXPECT_EQ(3u, word.get<counter>());
+    eld::arinc429::modify<counter>(word) -= uint8_t(4);
+    EXPECT_EQ(31u, word.get<counter>());
+    EXPECT_EQ(0x7c00u, word.get_raw());
+}
+
+TEST(ModifierTests, DecodeEncodeFallback)
+{
+    struct discrete : eld::arinc429::discrete_descriptor<discrete, 9>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, double, std::ratio<1, 16>>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<discrete, data>;
+
+    static_assert(eld::arinc429::detail::is_modifiable_in_place_t<discrete>(), "");
+    static_assert(!eld::arinc429::detail::is_addable_in_place_t<discrete>(), "");
+    static_assert(!eld::arinc429::detail::is_modifiable_in_place_t<data>(), "");
+
+    word_t word{ 0 };
+    eld::arinc429::modify<discrete>(word) |= true;
+    EXPECT_TRUE(word.get<discrete>());
+    eld::arinc429::modify<discrete>(word) += true;
+    EXPECT_TRUE(word.get<discrete>());
+    eld::arinc429::modify<discrete>(word) &= false;
+    EXPECT_FALSE(word.get<discrete>());
+
+    eld::arinc429::modify<data>(word) += 2.5;
+    eld::arinc429::modify<data>(word) -= 4.25;
+    EXPECT_DOUBLE_EQ(-1.75, word.get<data>());
+}
+
+TEST(ModifierTests, Batch)
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct counter : eld::arinc429::data_descriptor<counter, 11, 18, uint8_t>
+    {
+    };
+    struct discrete : eld::arinc429::discrete_descriptor<discrete, 29>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, counter, discrete>;
+
+    word_t words[5]{};
+    for (size_t i = 0; i < 5; ++i)
+    {
+        words[i].set_all(uint8_t(0201 + i), uint8_t(254 + i), false);
+    }
+
+    eld::arinc429::modify<counter>(words, 5) += uint8_t(3);
+    eld::arinc429::modify<discrete>(words + 1, 3) |= true;
+
+    for (size_t i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(uint8_t(0201 + i), words[i].get<label>());
+        EXPECT_EQ(uint8_t(254 + i + 3), words[i].get<counter>());
+        EXPECT_EQ(i >= 1 && i <= 3, words[i].get<discrete>());
+    }
+}
+
+TEST(StandardDescriptorsTests, FixedFields)
+{
+    struct label : eld::arinc429::label_descriptor<label>
+    {
+    };
+    struct sdi : eld::arinc429::sdi_descriptor<sdi>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, uint32_t>
+    {
+    };
+    struct ssm : eld::arinc429::ssm_descriptor<ssm>
+    {
+    };
+    struct parity : eld::arinc429::parity_descriptor<parity>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, sdi, data, ssm, parity>;
+
+    static_assert(eld::arinc429::traits::defined_bits_mask<word_t>() == 0xffffffff, "");
+    static_assert(eld::arinc429::bnr_valid_ssm == 0xc, "");
+
+    word_t word{ 0 };
+    word.set_all(uint8_t(0310),
+                 uint8_t(2),
+                 uint32_t(0x1234),
+                 uint8_t(eld::arinc429::bnr_ssm::normal_operation),
+                 uint8_t(1));
+    EXPECT_EQ(0xe048d213u, word.get_raw());
+    EXPECT_EQ(2u, word.get<sdi>());
+    EXPECT_EQ(uint8_t(eld::arinc429::bnr_ssm::normal_operation), word.get<ssm>());
+}
+
+TEST(SetAndGetWordTests, ConstWord)
+{
+    struct label : eld::arinc429::label_descriptor<label>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, int32_t>
+    {
+    };
+    using word_t = eld::arinc429::word_generic<label, data>;
+
+    static_assert(sizeof(word_t) == sizeof(eld::arinc429::traits::word_raw_type),
+                  "Word must have the size of a raw word!");
+    static_assert(std::is_trivially_copyable<word_t>::value, "Word must be trivially copyable!");
+    static_assert(std::is_standard_layout<word_t>::value, "Word must have standard layout!");
+
+    word_t word{ 0 };
+    word.set<label>(uint8_t(0310));
+    word.set<data>(-1234);
+
+    const word_t &constWord = word;
+    EXPECT_EQ(0310, constWord.get<label>());
+    EXPECT_EQ(-1234, constWord.get<data>());
+}
+
+namespace
+{
+    /**
+     * Scale factor type other than std::ratio.
+     */
+    struct quarter
+    {
+        static constexpr intmax_t num = 1;
+        static constexpr intmax_t den = 4;
+    };
+}
+
+TEST(SetAndGetWordTests, CustomScaleType)
+{
+    struct data : eld::arinc429::data_descriptor<data, 11, 29, double, quarter>
+    {
+    };
+    struct ratio_data : eld::arinc429::data_descriptor<ratio_data, 11, 29, double, std::ratio<1, 4>>
+    {
+    };
+
+    eld::arinc429::word_generic<data> word{ 0 };
+    word.set<data>(-12.75);
+    EXPECT_EQ(-12.75, word.get<data>());
+
+    eld::arinc429::word_generic<ratio_data> ratioWord{ 0 };
+    ratioWord.set<ratio_data>(-12.75);
+    EXPECT_EQ(ratioWord.get_raw(), word.get_raw());
+}
+
+template<size_t LSB, size_t MSB, typename T>
+void expect_same_as_runtime_field(eld::arinc429::traits::word_raw_type rawWord, T value)
+{
+    using is_signed_t = typename std::is_signed<T>::type;
+
+    T expected{};
+    T actual{};
+    eld::arinc429::detail::get_integral_value(expected, rawWord, LSB, MSB, is_signed_t{});
+    eld::arinc429::detail::get_integral_value<LSB, MSB>(actual, rawWord, is_signed_t{});
+    EXPECT_EQ(expected, actual);
+
+    eld::arinc429::traits::word_raw_type expectedRaw = rawWord;
+    eld::arinc429::traits::word_raw_type actualRaw = rawWord;
+    eld::arinc429::detail::set_integral_value(value, expectedRaw, LSB, MSB, is_signed_t{});
+    eld::arinc429::detail::set_integral_value<LSB, MSB>(value, actualRaw, is_signed_t{});
+    EXPECT_EQ(expectedRaw, actualRaw);
+}
+
+TEST(BitFieldTests, MasksAndShifts)
+{
+    using head_t = eld::arinc429::detail::bit_field<1, 8>;
+    using center_t = eld::arinc429::detail::bit_field<11, 20>;
+    using full_t = eld::arinc429::detail::bit_field<1, 32>;
+
+    static_assert(head_t::mask() == 0x000000ff, "");
+    static_assert(center_t::mask() == 0x000ffc00, "");
+    static_assert(center_t::shift() == 10, "");
+    static_assert(full_t::mask() == 0xffffffff, "");
+    static_assert(full_t::sign_bit() == 0x80000000, "");
+}
+
+TEST(BitFieldTests, SameAsRuntimeBitRange)
+{
+    const eld::arinc429::traits::word_raw_type rawWords[] = { 0,
+                                                              0xffffffff,
+                                                              0xf3f21872,
+                                                              0x80000001,
+                                                              0x55aa55aa };
+
+    for (auto rawWord : rawWords)
+    {
+        expect_same_as_runtime_field<1, 8>(rawWord, uint32_t(0x1ff));
+        expect_same_as_runtime_field<11, 20>(rawWord, uint32_t(517));
+        expect_same_as_runtime_field<32, 32>(rawWord, uint32_t(1));
+        expect_same_as_runtime_field<1, 32>(rawWord, uint32_t(0xdeadbeef));
+
+        expect_same_as_runtime_field<1, 10>(rawWord, int32_t(-511));
+        expect_same_as_runtime_field<9, 29>(rawWord, int32_t(-9));
+        expect_same_as_runtime_field<21, 32>(rawWord, int32_t(1000));
+        expect_same_as_runtime_field<1, 32>(rawWord, int32_t(-2147483647));
+    }
+}
+
+TEST(FixedScaleTests, IntegralPowerOfTwoResolution)
+{
+    struct data : eld::arinc429::data_descriptor<data,
+                                                 9,
+                                                 29,
+                                                 int32_t,
+                                                 eld::arinc429::fixed_scale<std::ratio<1, 4>>>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<data>;
+
+    word_t word{ 0 };
+    word.set<data>(-1001);
+    EXPECT_EQ(-1001, word.get<data>());
+
+    word.set_raw(uint32_t(-7) << 8);
+    EXPECT_EQ(-1, word.get<data>());
+
+    word.set_raw(uint32_t(7) << 8);
+    EXPECT_EQ(1, word.get<data>());
+}
+
+TEST(FixedScaleTests, IntegralArbitraryResolution)
+{
+    // 0.088 degrees per bit, decoded as millidegrees
+    struct data_2 : eld::arinc429::data_descriptor<data_2,
+                                                   18,
+                                                   29,
+                                                   int32_t,
+                                                   eld::arinc429::fixed_scale<std::ratio<88>>>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<data_2>;
+
+    word_t word{ 0xf3f21872 };
+    EXPECT_EQ(-135784, word.get<data_2>());
+
+    word.set_raw(0);
+    word.set<data_2>(-135784);
+    EXPECT_EQ(0x13f20000u, word.get_raw());
+}
+
+TEST(FixedScaleTests, FloatValue)
+{
+    struct data_2 :
+      eld::arinc429::
+          data_descriptor<data_2, 18, 29, float, eld::arinc429::fixed_scale<std::ratio<88, 1000>>>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<data_2>;
+
+    word_t word{ 0xf3f21872 };
+    EXPECT_FLOAT_EQ(-135.784f, word.get<data_2>());
+
+    struct data : eld::arinc429::data_descriptor<data,
+                                                 9,
+                                                 29,
+                                                 double,
+                                                 eld::arinc429::fixed_scale<std::ratio<1, 1024>>>
+    {
+    };
+
+    eld::arinc429::word_generic<data> bnrWord{ 0 };
+    bnrWord.set<data>(-33.5);
+    EXPECT_EQ(-33.5, bnrWord.get<data>());
+}
+
+namespace constexpr_words
+{
+    struct label : eld::arinc429::label_descriptor<label>
+    {
+    };
+    struct status : eld::arinc429::ssm_descriptor<status>
+    {
+    };
+    struct count : eld::arinc429::data_descriptor<count, 9, 16, uint8_t>
+    {
+    };
+    struct offset : eld::arinc429::data_descriptor<offset, 17, 29, int16_t>
+    {
+    };
+    struct altitude : eld::arinc429::bnr_descriptor<altitude, 17, std::ratio<1, 8>>
+    {
+    };
+    struct heading : eld::arinc429::
+                         bnr_descriptor<heading, 15, eld::arinc429::fixed_scale<std::ratio<1, 64>>>
+    {
+    };
+    struct frequency : eld::arinc429::bcd_descriptor<frequency, 11, 29>
+    {
+    };
+
+    using counter_word_t = eld::arinc429::word_generic<label, count, offset, status>;
+    using altitude_word_t = eld::arinc429::word_generic<label, altitude, status>;
+    using heading_word_t = eld::arinc429::word_generic<label, heading, status>;
+    using frequency_word_t = eld::arinc429::word_generic<label, frequency, status>;
+
+    constexpr counter_word_t make_counter_word(uint8_t countValue, int16_t offsetValue)
+    {
+        counter_word_t word{ 0 };
+        word.set<label>(uint8_t(0205));
+        word.set<count>(countValue);
+        word.set<offset>(offsetValue);
+        word.set<status>(uint8_t(3));
+        word.finalize();
+        return word;
+    }
+
+    constexpr altitude_word_t make_altitude_word(double value)
+    {
+        altitude_word_t word{ 0 };
+        word.set_all(uint8_t(0203), value, uint8_t(3));
+        word.finalize();
+        return word;
+    }
+
+    // transmit table in read-only memory
+    constexpr eld::arinc429::traits::word_raw_type transmit_table[]{
+        make_counter_word(1, -1).get_raw(),
+        make_counter_word(2, 100).get_raw(),
+        make_altitude_word(-12.5).get_raw(),
+        make_altitude_word(1024.125).get_raw()
+    };
+
+    constexpr heading_word_t make_heading_word(double value)
+    {
+        heading_word_t word{ 0 };
+        word.set<label>(uint8_t(0320));
+        word.set<heading>(value);
+        return word;
+    }
+
+    constexpr frequency_word_t make_frequency_word(uint32_t value)
+    {
+        frequency_word_t word{ 0 };
+        word.set<label>(uint8_t(0034));
+        word.set<frequency>(value);
+        return word;
+    }
+
+    static_assert(make_counter_word(1, -1).get<label>() == 0205, "");
+    static_assert(make_counter_word(1, -1).get<count>() == 1, "");
+    static_assert(make_counter_word(1, -1).get<offset>() == -1, "");
+    static_assert(make_counter_word(2, 100).get<offset>() == 100, "");
+    static_assert(eld::arinc429::validate_parity(transmit_table[1]), "");
+    static_assert(make_altitude_word(-12.5).get<altitude>() == -12.5, "");
+    static_assert(std::get<1>(make_altitude_word(1024.125).get_all()) == 1024.125, "");
+    static_assert(make_heading_word(-45.25).get<heading>() == -45.25, "");
+    static_assert(make_frequency_word(11795).get<frequency>() == 11795, "");
+}
+
+TEST(ConstexprTests, SameAsRuntime)
+{
+    using namespace constexpr_words;
+
+    counter_word_t counterWord{ 0 };
+    counterWord.set<label>(uint8_t(0205));
+    counterWord.set<count>(uint8_t(2));
+    counterWord.set<offset>(int16_t(100));
+    counterWord.set<status>(uint8_t(3));
+    counterWord.finalize();
+    EXPECT_EQ(counterWord.get_raw(), transmit_table[1]);
+
+    altitude_word_t altitudeWord{ 0 };
+    altitudeWord.set_all(uint8_t(0203), -12.5, uint8_t(3));
+    altitudeWord.finalize();
+    EXPECT_EQ(altitudeWord.get_raw(), transmit_table[2]);
+
+    heading_word_t headingWord{ 0 };
+    headingWord.set<label>(uint8_t(0320));
+    headingWord.set<heading>(-45.25);
+    constexpr heading_word_t expectedHeading = make_heading_word(-45.25);
+    EXPECT_EQ(expectedHeading.get_raw(), headingWord.get_raw());
+
+    frequency_word_t frequencyWord{ 0 };
+    frequencyWord.set<label>(uint8_t(0034));
+    frequencyWord.set<frequency>(11795u);
+    constexpr frequency_word_t expectedFrequency = make_frequency_word(11795);
+    EXPECT_EQ(expectedFrequency.get_raw(), frequencyWord.get_raw());
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,90 @@
+
+#include "arinc429/transmit.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data : eld::arinc429::data_descriptor<data, 9, 29, int32_t>
+    {
+    };
+    struct angle : eld::arinc429::data_descriptor<angle, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+
+    using data_word_t = eld::arinc429::word_generic<label, data>;
+    using angle_word_t = eld::arinc429::word_generic<label, angle>;
+
+    template<typename WordT>
+    WordT make_word(uint8_t labelValue)
+    {
+        WordT word{ 0 };
+        word.template set<label>(labelValue);
+        return word;
+    }
+
+    std::vector<uint8_t> frame_labels(const eld::arinc429::transmit_frame &frame)
+    {
+        std::vector<uint8_t> labels;
+        for (const auto wordRaw : frame)
+        {
+            labels.push_back(uint8_t(wordRaw & 0xffu));
+        }
+        return labels;
+    }
+}
+
+TEST(TransmitTests, Periods)
+{
+    eld::arinc429::transmit_scheduler<8> scheduler;
+    scheduler.add(make_word<data_word_t>(1), 2);
+    scheduler.add(make_word<data_word_t>(2), 3, 1);
+    // longer than the wheel
+    scheduler.add(make_word<data_word_t>(3), 10);
+
+    const std::vector<std::vector<uint8_t>> expected{
+        { 1, 3 }, { 2 }, { 1 }, {}, { 1, 2 }, {}, { 1 }, { 2 }, { 1 }, {}, { 1, 2, 3 }, {},
+    };
+    for (const auto &labels : expected)
+    {
+        EXPECT_EQ(labels, frame_labels(scheduler.tick()));
+    }
+    EXPECT_EQ(expected.size(), scheduler.now());
+}
+
+TEST(TransmitTests, SetReencodesField)
+{
+    eld::arinc429::transmit_scheduler<> scheduler;
+    auto dataSlot = scheduler.add(make_word<data_word_t>(0312), 1);
+    auto angleSlot = scheduler.add(make_word<angle_word_t>(0162), 2);
+
+    scheduler.set<data>(dataSlot, -9);
+    scheduler.set<angle>(angleSlot, -135.784);
+
+    auto frame = scheduler.tick();
+    ASSERT_EQ(2u, frame.size());
+
+    data_word_t dataWord(frame.data()[0]);
+    EXPECT_EQ(0312, dataWord.get<label>());
+    EXPECT_EQ(-9, dataWord.get<data>());
+
+    angle_word_t angleWord(frame.data()[1]);
+    EXPECT_EQ(0162, angleWord.get<label>());
+    EXPECT_EQ(-135.78399999999999, angleWord.get<angle>());
+
+    scheduler.set<data>(dataSlot, 7);
+    frame = scheduler.tick();
+    ASSERT_EQ(1u, frame.size());
+    dataWord = data_word_t(frame.data()[0]);
+    EXPECT_EQ(0312, dataWord.get<label>());
+    EXPECT_EQ(7, dataWord.get<data>());
+    EXPECT_EQ(dataWord.get_raw(), scheduler.word(dataSlot).get_raw());
+
+    scheduler.set_word(dataSlot, make_word<data_word_t>(0100));
+    EXPECT_EQ(std::vector<uint8_t>({ 0100, 0162 }), frame_labels(scheduler.tick()));
+}
@@ -0,0 +1,76 @@
+
+#include "arinc429/word_ref.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    struct label : eld::arinc429::data_descriptor<label, 1, 8, uint8_t>
+    {
+    };
+    struct data_2 : eld::arinc429::data_descriptor<data_2, 18, 29, double, std::ratio<88, 1000>>
+    {
+    };
+    struct state_matrix : eld::arinc429::data_descriptor<state_matrix, 30, 31, uint8_t>
+    {
+    };
+
+    using word_t = eld::arinc429::word_generic<label, data_2, state_matrix>;
+}
+
+TEST(WordRefTests, NativeStorage)
+{
+    eld::arinc429::traits::word_raw_type rawWords[]{ 0, 0xf3f21872 };
+
+    const eld::arinc429::word_view<word_t> view{ &rawWords[1] };
+    EXPECT_EQ(0162, view.get<label>());
+    EXPECT_EQ(-135.78399999999999, view.get<data_2>());
+
+    eld::arinc429::word_ref<word_t> ref{ &rawWords[0] };
+    ref.set<label>(uint8_t(0162));
+    ref.set<data_2>(-135.78399999999999);
+    ref.set<state_matrix>(uint8_t(3));
+    EXPECT_EQ(0x73f20072u, rawWords[0]);
+
+    eld::arinc429::modify<label>(ref) += uint8_t(1);
+    EXPECT_EQ(0x73f20073u, rawWords[0]);
+}
+
+TEST(WordRefTests, VolatileStorage)
+{
+    volatile eld::arinc429::traits::word_raw_type rawWord = 0xf3f21872;
+
+    eld::arinc429::volatile_word_ref<word_t> ref{ &rawWord };
+    EXPECT_EQ(3, ref.get<state_matrix>());
+
+    ref.set<state_matrix>(uint8_t(1));
+    EXPECT_EQ(0xb3f21872u, rawWord);
+}
+
+TEST(WordRefTests, ByteStorage)
+{
+    uint8_t bigEndian[]{ 0xf3, 0xf2, 0x18, 0x72 };
+    uint8_t littleEndian[]{ 0x72, 0x18, 0xf2, 0xf3 };
+
+    eld::arinc429::word_ref<word_t, eld::arinc429::big_endian_storage<>> bigRef{ bigEndian };
+    eld::arinc429::word_ref<word_t, eld::arinc429::little_endian_storage<>> littleRef{
+        littleEndian
+    };
+
+    EXPECT_EQ(0xf3f21872u, bigRef.get_raw());
+    EXPECT_EQ(0xf3f21872u, littleRef.get_raw());
+    EXPECT_EQ(-135.78399999999999, bigRef.get<data_2>());
+    EXPECT_EQ(-135.78399999999999, littleRef.get<data_2>());
+
+    bigRef.set<label>(uint8_t(0377));
+    littleRef.set<label>(uint8_t(0377));
+    EXPECT_EQ(0xff, bigEndian[3]);
+    EXPECT_EQ(0xff, littleEndian[0]);
+    EXPECT_EQ(0xf3, bigEndian[0]);
+    EXPECT_EQ(0xf3, littleEndian[3]);
+
+    const uint8_t constBytes[]{ 0xf3, 0xf2, 0x18, 0x72 };
+    const eld::arinc429::word_ref<word_t, eld::arinc429::big_endian_storage<const uint8_t>>
+        constRef{ constBytes };
+    EXPECT_EQ(0162, constRef.get<label>());
+}